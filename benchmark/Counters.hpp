@@ -0,0 +1,168 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Counters_hpp
+#define Counters_hpp
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+	#include <cerrno>
+	#include <cstring>
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+namespace bench {
+
+	/**
+	 * @brief The Counters class reads hardware performance counters of the
+	 *        calling thread around a measured region, through Linux
+	 *        perf_event_open. Events that can not be opened (no PMU, e.g. in
+	 *        a virtual machine, or not permitted by
+	 *        /proc/sys/kernel/perf_event_paranoid) are left out, and on other
+	 *        systems no counter is available at all.
+	 */
+	class Counters {
+	public:
+		struct Value {
+			std::string name;
+			double count;
+			bool available;     ///< False if the kernel never scheduled the event, so count means nothing.
+		};
+
+		inline Counters() = default;
+		Counters(const Counters &) = delete;
+		Counters & operator=(const Counters &) = delete;
+
+		inline ~Counters()
+		{
+			close();
+		}
+
+		/**
+		 *    @brief Opens the counters.
+		 *    @return A description of the events that could not be opened,
+		 *            empty if all could.
+		 */
+		inline std::string open()
+		{
+			close();
+			std::string missing;
+#if defined(__linux__)
+			struct Event {
+				const char *name;
+				std::uint32_t type;
+				std::uint64_t config;
+			};
+			static const std::uint64_t cacheReadMiss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			static const Event events[] = {
+				{"cycles",       PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+				{"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+				{"L1d-misses",   PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | cacheReadMiss},
+				{"LLC-misses",   PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+				{"dTLB-misses",  PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | cacheReadMiss},
+				{"page-faults",  PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS}
+			};
+			for (const Event &e : events) {
+				perf_event_attr attr;
+				std::memset(&attr, 0, sizeof(attr));
+				attr.size = sizeof(attr);
+				attr.type = e.type;
+				attr.config = e.config;
+				attr.disabled = 1;
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+				attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+				if (fd < 0) {
+					missing += (missing.empty() ? "" : ", ") + std::string(e.name) + " (" + std::strerror(errno) + ')';
+					continue;
+				}
+				_events.push_back(Open{e.name, fd});
+			}
+#else
+			missing = "perf events are only available on Linux";
+#endif
+			return missing;
+		}
+
+		/**
+		 *    @brief Tells whether at least one counter is open.
+		 */
+		inline bool available() const
+		{
+			return !_events.empty();
+		}
+
+		/**
+		 *    @brief Resets and starts the counters.
+		 */
+		inline void start()
+		{
+#if defined(__linux__)
+			for (const Open &e : _events) {
+				ioctl(e.fd, PERF_EVENT_IOC_RESET, 0);
+				ioctl(e.fd, PERF_EVENT_IOC_ENABLE, 0);
+			}
+#endif
+		}
+
+		/**
+		 *    @brief Stops the counters and gives their values, scaled when the
+		 *           kernel multiplexed them, or marked unavailable when it
+		 *           never scheduled them.
+		 */
+		inline std::vector<Value> stop()
+		{
+			std::vector<Value> values;
+#if defined(__linux__)
+			for (const Open &e : _events)
+				ioctl(e.fd, PERF_EVENT_IOC_DISABLE, 0);
+			for (const Open &e : _events) {
+				std::uint64_t data[3] = {0, 0, 0};    // value, time enabled, time running
+				if (read(e.fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+					continue;
+				if (data[2] == 0) {
+					values.push_back(Value{e.name, 0.0, false});
+					continue;
+				}
+				const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+				values.push_back(Value{e.name, static_cast<double>(data[0]) * scale, true});
+			}
+#endif
+			return values;
+		}
+
+	private:
+		struct Open {
+			const char *name;
+			int fd;
+		};
+
+		inline void close()
+		{
+#if defined(__linux__)
+			for (const Open &e : _events)
+				::close(e.fd);
+#endif
+			_events.clear();
+		}
+
+		std::vector<Open> _events;
+	};
+
+}
+
+#endif // Counters_hpp
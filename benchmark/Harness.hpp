@@ -0,0 +1,403 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Harness_hpp
+#define Harness_hpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <DopeVector/internal/BoundsCheck.hpp>
+
+#include "Counters.hpp"
+
+/**
+ * Registers the benchmark case class C under the given name, e.g.
+ * DOPE_BENCHMARK(Import, "grid/import").
+ */
+#define DOPE_BENCHMARK_CONCAT_(a, b) a ## b
+#define DOPE_BENCHMARK_CONCAT(a, b) DOPE_BENCHMARK_CONCAT_(a, b)
+#define DOPE_BENCHMARK(C, name) static ::bench::Registrar<C> DOPE_BENCHMARK_CONCAT(dope_benchmark_registrar_, __LINE__)(name)
+
+namespace bench {
+
+	using dope::SizeType;
+
+	/**
+	 * @brief Prevents the compiler from optimizing away the computation of
+	 *        value.
+	 */
+	template < typename T >
+	inline void keep(const T &value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r"(&value) : "memory");
+#else
+		static volatile const void *sink;
+		sink = &value;
+#endif
+	}
+
+	/**
+	 * @brief The Case class is a benchmark: prepare() builds its data for a
+	 *        working set of about a given number of bytes, run() is the
+	 *        timed operation and release() frees the data.
+	 */
+	class Case {
+	public:
+		virtual ~Case() = default;
+
+		/**
+		 *    @brief Builds the data of a working set of about bytes bytes.
+		 *    @return false if the case does not apply to that size.
+		 */
+		virtual bool prepare(const SizeType bytes) = 0;
+
+		/**
+		 *    @brief The timed operation.
+		 */
+		virtual void run() = 0;
+
+		/**
+		 *    @brief Gives the number of elements processed by run(), used to
+		 *           report counters per element (0 reports them per run).
+		 */
+		virtual SizeType elements() const
+		{
+			return 0;
+		}
+
+		/**
+		 *    @brief Frees the data built by prepare().
+		 */
+		virtual void release() = 0;
+	};
+
+	/**
+	 * @brief The Registry class lists the benchmark cases linked into the
+	 *        executable.
+	 */
+	class Registry {
+	public:
+		typedef std::function<std::unique_ptr<Case>()> Factory;
+
+		static inline std::vector<std::pair<std::string, Factory>> & cases()
+		{
+			static std::vector<std::pair<std::string, Factory>> all;
+			return all;
+		}
+	};
+
+	template < class C >
+	struct Registrar {
+		inline explicit Registrar(const char *name)
+		{
+			Registry::cases().emplace_back(name, []() { return std::unique_ptr<Case>(new C()); });
+		}
+	};
+
+	/**
+	 * @brief Command line options of the suite.
+	 */
+	struct Options {
+		std::vector<SizeType> sizes = {SizeType(32) << 10, SizeType(1) << 20, SizeType(32) << 20, SizeType(1) << 30};
+		SizeType repetitions = 11;              ///< Timed samples per case and size.
+		double minTime = 0.05;                  ///< Minimum duration of one sample, in seconds.
+		std::string filter;                     ///< Only run cases whose name contains this.
+		std::string json;                       ///< Where to write the JSON report ("-" for stdout).
+		bool counters = false;                  ///< Read hardware performance counters.
+	};
+
+	/**
+	 * @brief Timings of a case at a given size. Samples are in nanoseconds
+	 *        per run.
+	 */
+	struct Result {
+		std::string name;
+		SizeType bytes;
+		SizeType iterations;
+		SizeType elements;
+		std::vector<double> samples;
+		std::vector<Counters::Value> counters;  ///< Per element, or per run if elements is 0.
+	};
+
+	/**
+	 * @brief Gives the p-th percentile (p in [0, 1]) of sorted values, with
+	 *        linear interpolation between closest ranks.
+	 */
+	inline double percentile(const std::vector<double> &sorted, const double p)
+	{
+		if (sorted.empty())
+			return 0.0;
+		const double rank = p * static_cast<double>(sorted.size() - 1);
+		const SizeType low = static_cast<SizeType>(rank);
+		const SizeType high = std::min(low + 1, static_cast<SizeType>(sorted.size() - 1));
+		return sorted[low] + (rank - static_cast<double>(low)) * (sorted[high] - sorted[low]);
+	}
+
+	/**
+	 * @brief Parses a size such as 4096, 32K, 1M or 2G (powers of 1024).
+	 */
+	inline SizeType parseBytes(const std::string &text)
+	{
+		std::size_t end = 0;
+		const unsigned long long value = std::stoull(text, &end);
+		SizeType shift = 0;
+		if (end < text.size()) {
+			switch (text[end]) {
+			case 'k': case 'K': shift = 10; break;
+			case 'm': case 'M': shift = 20; break;
+			case 'g': case 'G': shift = 30; break;
+			default: throw std::invalid_argument("Invalid size " + text + '.');
+			}
+			if (end + 1 != text.size())
+				throw std::invalid_argument("Invalid size " + text + '.');
+		}
+		return static_cast<SizeType>(value) << shift;
+	}
+
+	inline std::string formatBytes(const SizeType bytes)
+	{
+		static const char *units[] = {"B", "K", "M", "G"};
+		SizeType value = bytes, unit = 0;
+		while (unit < 3 && value >= 1024 && value % 1024 == 0) {
+			value /= 1024;
+			++unit;
+		}
+		return std::to_string(value) + units[unit];
+	}
+
+	inline std::string escape(const std::string &text)
+	{
+		std::string escaped;
+		for (const char c : text) {
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+
+	/**
+	 * @brief Times a prepared case: one untimed run sets how many runs make
+	 *        a sample of at least options.minTime seconds, then
+	 *        options.repetitions samples are taken. If counters is not
+	 *        null, they are read over all the samples.
+	 */
+	inline Result measure(const std::string &name, const SizeType bytes, Case &c, const Options &options, Counters *counters)
+	{
+		typedef std::chrono::steady_clock Clock;
+		Result result;
+		result.name = name;
+		result.bytes = bytes;
+
+		Clock::time_point start = Clock::now();
+		c.run();
+		const double warmup = std::chrono::duration<double>(Clock::now() - start).count();
+		result.iterations = warmup >= options.minTime ? 1 : static_cast<SizeType>(options.minTime / std::max(warmup, 1e-9)) + 1;
+		result.elements = c.elements();
+
+		if (counters)
+			counters->start();
+		for (SizeType r = static_cast<SizeType>(0); r < options.repetitions; ++r) {
+			start = Clock::now();
+			for (SizeType i = static_cast<SizeType>(0); i < result.iterations; ++i)
+				c.run();
+			const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			result.samples.push_back(elapsed / static_cast<double>(result.iterations));
+		}
+		if (counters) {
+			const double runs = static_cast<double>(result.iterations * options.repetitions * std::max(result.elements, static_cast<SizeType>(1)));
+			for (Counters::Value &v : counters->stop())
+				result.counters.push_back(Counters::Value{v.name, v.count / runs, v.available});
+		}
+		return result;
+	}
+
+	inline void writeJson(std::ostream &out, const std::vector<Result> &results, const Options &options)
+	{
+		out << "{\n  \"context\": {\n";
+#if defined(__VERSION__)
+		out << "    \"compiler\": \"" << escape(__VERSION__) << "\",\n";
+#endif
+		out << "    \"bounds_check\": " << DOPE_BOUNDS_CHECK << ",\n";
+		out << "    \"repetitions\": " << options.repetitions << ",\n";
+		out << "    \"min_time_s\": " << options.minTime << "\n  },\n";
+		out << "  \"benchmarks\": [";
+		out << std::setprecision(10);
+		for (SizeType n = static_cast<SizeType>(0); n < results.size(); ++n) {
+			const Result &r = results[n];
+			std::vector<double> sorted(r.samples);
+			std::sort(sorted.begin(), sorted.end());
+			out << (n ? ",\n" : "\n") << "    {\"name\": \"" << escape(r.name) << "\", \"bytes\": " << r.bytes
+			    << ", \"iterations\": " << r.iterations
+			    << ", \"elements\": " << r.elements
+			    << ", \"median_ns\": " << percentile(sorted, 0.5)
+			    << ", \"p10_ns\": " << percentile(sorted, 0.1)
+			    << ", \"p90_ns\": " << percentile(sorted, 0.9)
+			    << ", \"min_ns\": " << sorted.front()
+			    << ", \"max_ns\": " << sorted.back()
+			    << ", \"samples_ns\": [";
+			for (SizeType s = static_cast<SizeType>(0); s < r.samples.size(); ++s)
+				out << (s ? ", " : "") << r.samples[s];
+			out << ']';
+			if (!r.counters.empty()) {
+				out << ", \"counters\": {";
+				for (SizeType v = static_cast<SizeType>(0); v < r.counters.size(); ++v) {
+					out << (v ? ", " : "") << '"' << r.counters[v].name << "\": ";
+					if (r.counters[v].available)
+						out << r.counters[v].count;
+					else
+						out << "null";
+				}
+				out << '}';
+			}
+			out << '}';
+		}
+		out << "\n  ]\n}\n";
+	}
+
+	inline void usage(const char *program)
+	{
+		std::cerr << "Usage: " << program << " [options]\n"
+		          << "  --sizes LIST        working set sizes, e.g. 32K,1M,32M,1G (default)\n"
+		          << "  --repetitions N     timed samples per case and size (default 11)\n"
+		          << "  --min-time S        minimum duration of a sample in seconds (default 0.05)\n"
+		          << "  --filter TEXT       only run cases whose name contains TEXT\n"
+		          << "  --json FILE         write a JSON report to FILE (- for stdout)\n"
+		          << "  --counters          read hardware performance counters (Linux perf events)\n"
+		          << "  --list              list the cases and exit\n";
+	}
+
+	/**
+	 * @brief Entry point of the suite: parses the command line, runs the
+	 *        selected cases at every size and reports median and
+	 *        percentiles as a table and, optionally, as JSON.
+	 */
+	inline int run(int argc, char *argv[])
+	{
+		Options options;
+		try {
+			for (int a = 1; a < argc; ++a) {
+				const std::string arg = argv[a];
+				const bool hasValue = a + 1 < argc;
+				if (arg == "--list") {
+					for (const auto &c : Registry::cases())
+						std::cout << c.first << '\n';
+					return EXIT_SUCCESS;
+				} else if (arg == "--sizes" && hasValue) {
+					options.sizes.clear();
+					std::stringstream list(argv[++a]);
+					std::string item;
+					while (std::getline(list, item, ','))
+						options.sizes.push_back(parseBytes(item));
+				} else if (arg == "--repetitions" && hasValue) {
+					options.repetitions = std::max(static_cast<SizeType>(std::stoull(argv[++a])), static_cast<SizeType>(1));
+				} else if (arg == "--min-time" && hasValue) {
+					options.minTime = std::stod(argv[++a]);
+				} else if (arg == "--filter" && hasValue) {
+					options.filter = argv[++a];
+				} else if (arg == "--json" && hasValue) {
+					options.json = argv[++a];
+				} else if (arg == "--counters") {
+					options.counters = true;
+				} else {
+					usage(argv[0]);
+					return EXIT_FAILURE;
+				}
+			}
+		} catch (const std::exception &e) {
+			std::cerr << e.what() << '\n';
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		// the table goes to stderr when the JSON report takes stdout
+		std::ostream &table = options.json == "-" ? std::cerr : std::cout;
+
+		Counters counters;
+		if (options.counters) {
+			const std::string missing = counters.open();
+			if (!missing.empty())
+				std::cerr << "Counters not available: " << missing << '\n';
+		}
+		table << std::left << std::setw(32) << "case" << std::right << std::setw(8) << "size"
+		      << std::setw(14) << "median ns" << std::setw(14) << "p10 ns" << std::setw(14) << "p90 ns"
+		      << std::setw(12) << "GB/s" << '\n';
+
+		std::vector<Result> results;
+		for (const auto &entry : Registry::cases()) {
+			if (entry.first.find(options.filter) == std::string::npos)
+				continue;
+			std::unique_ptr<Case> c = entry.second();
+			for (const SizeType bytes : options.sizes) {
+				// run() may allocate too, e.g. temporaries of safeImport
+				try {
+					if (!c->prepare(bytes))
+						continue;
+					results.push_back(measure(entry.first, bytes, *c, options, counters.available() ? &counters : nullptr));
+				} catch (const std::bad_alloc &) {
+					if (counters.available())
+						counters.stop();
+					c->release();
+					table << std::left << std::setw(32) << entry.first << std::right << std::setw(8) << formatBytes(bytes) << "  skipped: out of memory\n";
+					continue;
+				}
+				c->release();
+
+				std::vector<double> sorted(results.back().samples);
+				std::sort(sorted.begin(), sorted.end());
+				const double median = percentile(sorted, 0.5);
+				table << std::left << std::setw(32) << entry.first << std::right << std::setw(8) << formatBytes(bytes)
+				      << std::fixed << std::setprecision(1)
+				      << std::setw(14) << median << std::setw(14) << percentile(sorted, 0.1) << std::setw(14) << percentile(sorted, 0.9)
+				      << std::setprecision(2) << std::setw(12) << static_cast<double>(bytes) / median << '\n';
+				table.unsetf(std::ios_base::floatfield);
+				if (!results.back().counters.empty()) {
+					table << "    per " << (results.back().elements ? "element:" : "run:") << std::setprecision(4);
+					for (const Counters::Value &v : results.back().counters) {
+						table << "  " << v.name << ' ';
+						if (v.available)
+							table << v.count;
+						else
+							table << "n/a";
+					}
+					table << '\n';
+				}
+			}
+		}
+
+		if (options.json == "-") {
+			writeJson(std::cout, results, options);
+		} else if (!options.json.empty()) {
+			std::ofstream file(options.json);
+			if (!file) {
+				std::cerr << "Cannot write " << options.json << '\n';
+				return EXIT_FAILURE;
+			}
+			writeJson(file, results, options);
+		}
+		return EXIT_SUCCESS;
+	}
+
+}
+
+#endif // Harness_hpp
@@ -0,0 +1,31 @@
+#!/bin/sh
+# Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+#
+# This source code is part of DopeVector header library
+# and it is subject to Apache 2.0 License.
+#
+# Builds and runs the benchmarks, then compares them with baseline.json,
+# exiting with a non-zero status on significant regressions.
+#
+#     benchmark/check.sh [--threshold 0.10] [--alpha 0.01]
+#     benchmark/check.sh --update       # record a new baseline.json
+#
+# Timings depend on the machine: record the baseline on the machine that
+# runs the check. The build directory can be set with BENCHMARK_BUILD_DIR.
+
+set -e
+
+source_dir=$(cd "$(dirname "$0")" && pwd)
+build_dir=${BENCHMARK_BUILD_DIR:-${TMPDIR:-/tmp}/dope_vector_benchmark}
+runs="--sizes 32K,1M,32M --repetitions 11 --min-time 0.05"
+
+cmake -S "$source_dir" -B "$build_dir" -DCMAKE_BUILD_TYPE=Release > /dev/null
+cmake --build "$build_dir" --target benchmarks benchmark_compare > /dev/null
+
+if [ "$1" = "--update" ]; then
+	"$build_dir/benchmarks" $runs --json "$source_dir/baseline.json"
+	exit 0
+fi
+
+"$build_dir/benchmarks" $runs --json "$build_dir/current.json"
+"$build_dir/benchmark_compare" "$source_dir/baseline.json" "$build_dir/current.json" "$@"
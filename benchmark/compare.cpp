@@ -0,0 +1,337 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+// Compares two JSON reports of the benchmarks executable and exits with a
+// non-zero status when a case got significantly slower:
+//
+//     benchmark_compare baseline.json current.json [--threshold 0.10] [--alpha 0.01]
+//
+// A case regresses when its median grows by more than the threshold and a
+// one-sided Mann-Whitney U test on the raw samples rejects, at level alpha,
+// the hypothesis that it is not slower than the baseline.
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	// A parsed JSON value. Only what the reports need is kept: numbers,
+	// strings, arrays and objects.
+	struct Json {
+		enum Type { Null, Bool, Number, String, Array, Object };
+
+		Type type = Null;
+		double number = 0.0;
+		std::string string;
+		std::vector<Json> array;
+		std::vector<std::pair<std::string, Json>> object;
+
+		const Json * find(const std::string &key) const
+		{
+			for (const auto &member : object)
+				if (member.first == key)
+					return &member.second;
+			return nullptr;
+		}
+	};
+
+	// Recursive descent parser of RFC 8259 JSON, without \u escapes
+	// beyond ASCII.
+	class Parser {
+	public:
+		explicit Parser(const std::string &text)
+		    : _text(text)
+		    , _position(0)
+		{ }
+
+		Json parse()
+		{
+			Json value = parseValue();
+			skipSpaces();
+			if (_position != _text.size())
+				fail("trailing characters");
+			return value;
+		}
+
+	private:
+		[[noreturn]] void fail(const std::string &what) const
+		{
+			std::stringstream stream;
+			stream << "JSON error at offset " << _position << ": " << what;
+			throw std::runtime_error(stream.str());
+		}
+
+		void skipSpaces()
+		{
+			while (_position < _text.size() && std::isspace(static_cast<unsigned char>(_text[_position])))
+				++_position;
+		}
+
+		bool consume(const char c)
+		{
+			skipSpaces();
+			if (_position < _text.size() && _text[_position] == c) {
+				++_position;
+				return true;
+			}
+			return false;
+		}
+
+		void expect(const char c)
+		{
+			if (!consume(c))
+				fail(std::string("expected '") + c + '\'');
+		}
+
+		bool keyword(const char *word)
+		{
+			const std::string w(word);
+			if (_text.compare(_position, w.size(), w) == 0) {
+				_position += w.size();
+				return true;
+			}
+			return false;
+		}
+
+		std::string parseString()
+		{
+			expect('"');
+			std::string s;
+			while (_position < _text.size() && _text[_position] != '"') {
+				char c = _text[_position++];
+				if (c == '\\') {
+					if (_position >= _text.size())
+						fail("unterminated escape");
+					c = _text[_position++];
+					switch (c) {
+					case 'n': s += '\n'; break;
+					case 't': s += '\t'; break;
+					case 'r': s += '\r'; break;
+					case 'b': s += '\b'; break;
+					case 'f': s += '\f'; break;
+					case 'u':
+						if (_position + 4 > _text.size())
+							fail("bad unicode escape");
+						s += static_cast<char>(std::stoi(_text.substr(_position, 4), nullptr, 16) & 0x7F);
+						_position += 4;
+						break;
+					default: s += c; break;
+					}
+				} else {
+					s += c;
+				}
+			}
+			if (_position >= _text.size())
+				fail("unterminated string");
+			++_position;
+			return s;
+		}
+
+		Json parseValue()
+		{
+			skipSpaces();
+			if (_position >= _text.size())
+				fail("unexpected end");
+			Json value;
+			const char c = _text[_position];
+			if (c == '{') {
+				value.type = Json::Object;
+				++_position;
+				if (!consume('}')) {
+					do {
+						skipSpaces();
+						std::string key = parseString();
+						expect(':');
+						value.object.emplace_back(std::move(key), parseValue());
+					} while (consume(','));
+					expect('}');
+				}
+			} else if (c == '[') {
+				value.type = Json::Array;
+				++_position;
+				if (!consume(']')) {
+					do
+						value.array.push_back(parseValue());
+					while (consume(','));
+					expect(']');
+				}
+			} else if (c == '"') {
+				value.type = Json::String;
+				value.string = parseString();
+			} else if (keyword("true")) {
+				value.type = Json::Bool;
+				value.number = 1.0;
+			} else if (keyword("false")) {
+				value.type = Json::Bool;
+			} else if (keyword("null")) {
+				value.type = Json::Null;
+			} else {
+				const char *begin = _text.c_str() + _position;
+				char *end = nullptr;
+				value.type = Json::Number;
+				value.number = std::strtod(begin, &end);
+				if (end == begin)
+					fail("unexpected character");
+				_position += static_cast<std::size_t>(end - begin);
+			}
+			return value;
+		}
+
+		const std::string &_text;
+		std::size_t _position;
+	};
+
+	typedef std::pair<std::string, double> Key;    // name and bytes of a case
+
+	std::map<Key, std::vector<double>> load(const std::string &path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			throw std::runtime_error("Cannot read " + path);
+		std::stringstream content;
+		content << file.rdbuf();
+		const Json root = Parser(content.str()).parse();
+		const Json *benchmarks = root.find("benchmarks");
+		if (!benchmarks || benchmarks->type != Json::Array)
+			throw std::runtime_error(path + " has no benchmarks array");
+		std::map<Key, std::vector<double>> results;
+		for (const Json &b : benchmarks->array) {
+			const Json *name = b.find("name"), *bytes = b.find("bytes"), *samples = b.find("samples_ns");
+			if (!name || !bytes || !samples || samples->array.empty())
+				throw std::runtime_error(path + " has an incomplete benchmark entry");
+			std::vector<double> &values = results[Key(name->string, bytes->number)];
+			for (const Json &s : samples->array)
+				values.push_back(s.number);
+		}
+		return results;
+	}
+
+	double median(std::vector<double> values)
+	{
+		std::sort(values.begin(), values.end());
+		const std::size_t n = values.size();
+		return n % 2 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+	}
+
+	// One-sided Mann-Whitney U test: probability of observing samples of
+	// current at least this much larger than those of baseline if both
+	// came from the same distribution. Normal approximation with tie and
+	// continuity corrections.
+	double mannWhitney(const std::vector<double> &baseline, const std::vector<double> &current)
+	{
+		const double n1 = static_cast<double>(current.size());
+		const double n2 = static_cast<double>(baseline.size());
+		std::vector<std::pair<double, bool>> all;
+		for (const double v : current)
+			all.emplace_back(v, true);
+		for (const double v : baseline)
+			all.emplace_back(v, false);
+		std::sort(all.begin(), all.end());
+
+		double rankSum = 0.0, ties = 0.0;
+		for (std::size_t i = 0; i < all.size(); ) {
+			std::size_t j = i;
+			while (j < all.size() && all[j].first == all[i].first)
+				++j;
+			const double rank = 0.5 * static_cast<double>(i + j + 1);    // average of ranks i+1..j
+			const double t = static_cast<double>(j - i);
+			ties += t * t * t - t;
+			for (std::size_t k = i; k < j; ++k)
+				if (all[k].second)
+					rankSum += rank;
+			i = j;
+		}
+
+		const double n = n1 + n2;
+		const double u = rankSum - n1 * (n1 + 1.0) / 2.0;
+		const double mean = n1 * n2 / 2.0;
+		const double variance = n1 * n2 / 12.0 * ((n + 1.0) - ties / (n * (n - 1.0)));
+		if (variance <= 0.0)
+			return u > mean ? 0.0 : 1.0;
+		const double z = (u - mean - 0.5) / std::sqrt(variance);
+		return 0.5 * std::erfc(z / std::sqrt(2.0));
+	}
+
+	void usage(const char *program)
+	{
+		std::cerr << "Usage: " << program << " baseline.json current.json [--threshold 0.10] [--alpha 0.01]\n";
+	}
+
+}
+
+int main(int argc, char *argv[])
+{
+	std::vector<std::string> files;
+	double threshold = 0.10, alpha = 0.01;
+	for (int a = 1; a < argc; ++a) {
+		const std::string arg = argv[a];
+		if (arg == "--threshold" && a + 1 < argc)
+			threshold = std::atof(argv[++a]);
+		else if (arg == "--alpha" && a + 1 < argc)
+			alpha = std::atof(argv[++a]);
+		else if (!arg.empty() && arg[0] != '-')
+			files.push_back(arg);
+		else {
+			usage(argv[0]);
+			return 2;
+		}
+	}
+	if (files.size() != 2) {
+		usage(argv[0]);
+		return 2;
+	}
+
+	std::map<Key, std::vector<double>> baseline, current;
+	try {
+		baseline = load(files[0]);
+		current = load(files[1]);
+	} catch (const std::exception &e) {
+		std::cerr << e.what() << '\n';
+		return 2;
+	}
+
+	std::cout << std::left << std::setw(32) << "case" << std::right << std::setw(12) << "bytes"
+	          << std::setw(14) << "baseline ns" << std::setw(14) << "current ns" << std::setw(10) << "change"
+	          << std::setw(10) << "p" << "\n";
+	std::size_t regressions = 0, missing = 0;
+	for (const auto &entry : baseline) {
+		const auto found = current.find(entry.first);
+		if (found == current.end()) {
+			++missing;
+			continue;
+		}
+		const double before = median(entry.second);
+		const double after = median(found->second);
+		const double change = after / before - 1.0;
+		const double p = mannWhitney(entry.second, found->second);
+		const bool regressed = change > threshold && p < alpha;
+		regressions += regressed ? 1 : 0;
+		std::cout << std::left << std::setw(32) << entry.first.first << std::right << std::setw(12) << static_cast<unsigned long long>(entry.first.second)
+		          << std::fixed << std::setprecision(1) << std::setw(14) << before << std::setw(14) << after
+		          << std::showpos << std::setw(9) << 100.0 * change << '%' << std::noshowpos
+		          << std::setprecision(4) << std::setw(10) << p << (regressed ? "  REGRESSION" : "") << '\n';
+	}
+	if (missing)
+		std::cout << missing << " baseline case(s) missing from " << files[1] << '\n';
+	std::cout.unsetf(std::ios_base::floatfield);
+	std::cout << std::setprecision(6) << regressions << " regression(s) above " << 100.0 * threshold << "% at alpha " << alpha << '\n';
+	return regressions ? 1 : 0;
+}
@@ -0,0 +1,292 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <DopeVector/Grid.hpp>
+
+#include "Harness.hpp"
+
+using namespace dope;
+
+namespace {
+
+	// Side of a cubic grid of floats taking about bytes bytes.
+	SizeType side(const SizeType bytes)
+	{
+		SizeType s = static_cast<SizeType>(std::cbrt(static_cast<double>(bytes / sizeof(float))));
+		while ((s + 1) * (s + 1) * (s + 1) * sizeof(float) <= bytes)
+			++s;
+		while (s > 2 && s * s * s * sizeof(float) > bytes)
+			--s;
+		return std::max(s, static_cast<SizeType>(2));
+	}
+
+	// A cubic grid of random floats, shared by most cases.
+	class GridCase : public bench::Case {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			const Index3 size = Index3::Constant(side(bytes));
+			_grid.resize(size);
+			std::mt19937 engine(42);
+			std::uniform_real_distribution<float> values(0.0f, 1.0f);
+			for (float &v : _grid)
+				v = values(engine);
+			return true;
+		}
+
+		SizeType elements() const override
+		{
+			return _grid.size();
+		}
+
+		void release() override
+		{
+			_grid.clear();
+		}
+
+	protected:
+		Grid<float, 3> _grid;
+	};
+
+	// Sums all elements through at(Index3).
+	class AccessAt : public GridCase {
+	public:
+		void run() override
+		{
+			const Index3 size = _grid.allSizes();
+			float sum = 0.0f;
+			for (SizeType i = static_cast<SizeType>(0); i < size[0]; ++i)
+				for (SizeType j = static_cast<SizeType>(0); j < size[1]; ++j)
+					for (SizeType k = static_cast<SizeType>(0); k < size[2]; ++k)
+						sum += _grid.at(Index3({i, j, k}));
+			bench::keep(sum);
+		}
+	};
+
+	// Sums all elements through operator[] chains.
+	class AccessSubscript : public GridCase {
+	public:
+		void run() override
+		{
+			const Index3 size = _grid.allSizes();
+			float sum = 0.0f;
+			for (SizeType i = static_cast<SizeType>(0); i < size[0]; ++i)
+				for (SizeType j = static_cast<SizeType>(0); j < size[1]; ++j)
+					for (SizeType k = static_cast<SizeType>(0); k < size[2]; ++k)
+						sum += _grid[i][j][k];
+			bench::keep(sum);
+		}
+	};
+
+	// Reads elements at random positions, as many as the grid has (at
+	// most 2^20 per run).
+	class AccessRandom : public GridCase {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			GridCase::prepare(bytes);
+			const SizeType s = _grid.sizeAt(0);
+			std::mt19937 engine(7);
+			std::uniform_int_distribution<SizeType> coordinates(0, s - 1);
+			_positions.resize(std::min(_grid.size(), static_cast<SizeType>(1) << 20));
+			for (Index3 &p : _positions)
+				p = Index3({coordinates(engine), coordinates(engine), coordinates(engine)});
+			return true;
+		}
+
+		void run() override
+		{
+			float sum = 0.0f;
+			for (const Index3 &p : _positions)
+				sum += _grid.at(p);
+			bench::keep(sum);
+		}
+
+		SizeType elements() const override
+		{
+			return _positions.size();
+		}
+
+		void release() override
+		{
+			GridCase::release();
+			_positions = std::vector<Index3>();
+		}
+
+	private:
+		std::vector<Index3> _positions;
+	};
+
+	// Sums all elements through the iterators.
+	class Iterate : public GridCase {
+	public:
+		void run() override
+		{
+			float sum = 0.0f;
+			for (Grid<float, 3>::const_iterator it = _grid.cbegin(); it != _grid.cend(); ++it)
+				sum += *it;
+			bench::keep(sum);
+		}
+	};
+
+	// Sums all elements slice by slice along the last dimension, so that
+	// every slice is traversed with strides of side^2 and side elements.
+	class StridedSlices : public GridCase {
+	public:
+		void run() override
+		{
+			const SizeType side = _grid.sizeAt(0);
+			float sum = 0.0f;
+			for (SizeType k = static_cast<SizeType>(0); k < side; ++k) {
+				const DopeVector<float, 2> slice = _grid.slice(2, k);
+				for (SizeType i = static_cast<SizeType>(0); i < side; ++i)
+					for (SizeType j = static_cast<SizeType>(0); j < side; ++j)
+						sum += slice[i][j];
+			}
+			bench::keep(sum);
+		}
+	};
+
+	// A source grid and a destination of the same size.
+	class CopyCase : public GridCase {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			GridCase::prepare(bytes);
+			_destination.resize(_grid.allSizes());
+			return true;
+		}
+
+		void release() override
+		{
+			GridCase::release();
+			_destination.clear();
+		}
+
+	protected:
+		Grid<float, 3> _destination;
+	};
+
+	// Grid to grid import with the same layout: the whole buffer is copied.
+	class ImportGrid : public CopyCase {
+	public:
+		void run() override
+		{
+			_destination.import(_grid);
+			bench::keep(_destination.data());
+		}
+	};
+
+	// Import between views, as DopeVector's.
+	class ImportView : public CopyCase {
+	public:
+		void run() override
+		{
+			DopeVector<float, 3> &destination = _destination;
+			destination.import(_grid);
+			bench::keep(_destination.data());
+		}
+	};
+
+	class SafeImport : public CopyCase {
+	public:
+		void run() override
+		{
+			_destination.safeImport(_grid);
+			bench::keep(_destination.data());
+		}
+	};
+
+	// Permutes the dimensions of the grid and materializes the result
+	// into a dense grid, i.e. a 3D transposition.
+	class PermuteMaterialize : public CopyCase {
+	public:
+		void run() override
+		{
+			const Index3 order = {2, 1, 0};
+			_destination.import(_grid.permute(order));
+			bench::keep(_destination.data());
+		}
+	};
+
+	// Extracts the central window of half the side and materializes it.
+	class Window : public GridCase {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			GridCase::prepare(bytes);
+			_size = Index3::Constant(std::max(_grid.sizeAt(0) / 2, static_cast<SizeType>(1)));
+			_start = Index3::Constant(_grid.sizeAt(0) / 4);
+			_window.resize(_size);
+			return true;
+		}
+
+		void run() override
+		{
+			_window.import(_grid.window(_start, _size));
+			bench::keep(_window.data());
+		}
+
+		SizeType elements() const override
+		{
+			return _window.size();
+		}
+
+		void release() override
+		{
+			GridCase::release();
+			_window.clear();
+		}
+
+	private:
+		Index3 _start, _size;
+		Grid<float, 3> _window;
+	};
+
+	// Grows each side by one element, then shrinks back, alternating runs.
+	class ConservativeResize : public GridCase {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			GridCase::prepare(bytes);
+			_original = _grid.allSizes();
+			return true;
+		}
+
+		void run() override
+		{
+			Index3 size(_original);
+			if (_grid.allSizes() == _original)
+				size += Index3::Ones();
+			_grid.conservativeResize(size);
+			bench::keep(_grid.data());
+		}
+
+	private:
+		Index3 _original;
+	};
+
+}
+
+DOPE_BENCHMARK(AccessAt, "grid/access/at");
+DOPE_BENCHMARK(AccessSubscript, "grid/access/subscript");
+DOPE_BENCHMARK(AccessRandom, "grid/access/random");
+DOPE_BENCHMARK(Iterate, "grid/iterate");
+DOPE_BENCHMARK(StridedSlices, "grid/slice/strided");
+DOPE_BENCHMARK(ImportGrid, "grid/import");
+DOPE_BENCHMARK(ImportView, "grid/import/view");
+DOPE_BENCHMARK(SafeImport, "grid/safeImport");
+DOPE_BENCHMARK(PermuteMaterialize, "grid/permute+materialize");
+DOPE_BENCHMARK(Window, "grid/window");
+DOPE_BENCHMARK(ConservativeResize, "grid/conservativeResize");
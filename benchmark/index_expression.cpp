@@ -0,0 +1,97 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <vector>
+#include <random>
+
+#include <DopeVector/Index.hpp>
+
+#include "Harness.hpp"
+
+using namespace dope;
+
+namespace {
+
+	// Computes (a + b) * s - o for each pair of indices in a working set of
+	// the requested size, with Index expressions or per-component
+	// arithmetic written by hand.
+	class IndexCase : public bench::Case {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			const SizeType samples = std::max(bytes / (2 * sizeof(Index3)), static_cast<SizeType>(1));
+			std::mt19937 engine(42);
+			std::uniform_int_distribution<SizeType> coordinates(1, 1024);
+			_a.resize(samples);
+			_b.resize(samples);
+			for (SizeType n = static_cast<SizeType>(0); n < samples; ++n) {
+				_a[n] = Index3({coordinates(engine), coordinates(engine), coordinates(engine)});
+				_b[n] = Index3({coordinates(engine), coordinates(engine), coordinates(engine)});
+			}
+			return true;
+		}
+
+		SizeType elements() const override
+		{
+			return _a.size();
+		}
+
+		void release() override
+		{
+			_a = std::vector<Index3>();
+			_b = std::vector<Index3>();
+		}
+
+	protected:
+		template < class F >
+		void apply(F f) const
+		{
+			SizeType sum = 0;
+			for (SizeType n = static_cast<SizeType>(0); n < _a.size(); ++n) {
+				const Index3 r = f(_a[n], _b[n]);
+				sum += r[0] ^ r[1] ^ r[2];
+			}
+			bench::keep(sum);
+		}
+
+		std::vector<Index3> _a, _b;
+	};
+
+	class Expression : public IndexCase {
+	public:
+		void run() override
+		{
+			const Index3 s = Index3::Constant(3);
+			const Index3 o = Index3::Constant(1);
+			apply([&s, &o](const Index3 &x, const Index3 &y) {
+				return Index3((x + y) * s - o);
+			});
+		}
+	};
+
+	class HandWritten : public IndexCase {
+	public:
+		void run() override
+		{
+			const Index3 s = Index3::Constant(3);
+			const Index3 o = Index3::Constant(1);
+			apply([&s, &o](const Index3 &x, const Index3 &y) {
+				Index3 r;
+				for (SizeType d = static_cast<SizeType>(0); d < 3; ++d)
+					r[d] = (x[d] + y[d]) * s[d] - o[d];
+				return r;
+			});
+		}
+	};
+
+}
+
+DOPE_BENCHMARK(Expression, "index/expression");
+DOPE_BENCHMARK(HandWritten, "index/hand-written");
@@ -0,0 +1,137 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <vector>
+#include <random>
+
+#include <DopeVector/Grid.hpp>
+#include <DopeVector/BrickedGrid.hpp>
+#include <DopeVector/MortonGrid.hpp>
+
+#include "Harness.hpp"
+
+using namespace dope;
+
+namespace {
+
+	// Largest power of two side of a cubic grid of floats in bytes bytes.
+	SizeType powerOfTwoSide(const SizeType bytes)
+	{
+		SizeType s = static_cast<SizeType>(4);
+		while ((2 * s) * (2 * s) * (2 * s) * sizeof(float) <= bytes)
+			s *= 2;
+		return s;
+	}
+
+	// A row-major grid of random floats and random centers of 3x3x3
+	// neighbourhoods (2^16 per run).
+	class LayoutCase : public bench::Case {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			const SizeType side = powerOfTwoSide(bytes);
+			_grid.resize(Index3::Constant(side));
+			std::mt19937 engine(42);
+			std::uniform_real_distribution<float> values(0.0f, 1.0f);
+			for (float &v : _grid)
+				v = values(engine);
+			std::uniform_int_distribution<SizeType> coordinates(1, side - 2);
+			_centers.resize(static_cast<SizeType>(1) << 16);
+			for (Index3 &c : _centers)
+				c = Index3({coordinates(engine), coordinates(engine), coordinates(engine)});
+			return true;
+		}
+
+		SizeType elements() const override
+		{
+			return 27 * _centers.size();
+		}
+
+		void release() override
+		{
+			_grid.clear();
+			_centers = std::vector<Index3>();
+		}
+
+	protected:
+		// Sums the 3x3x3 neighbourhood of each center.
+		template < class G >
+		void neighbourhoods(const G &grid) const
+		{
+			float sum = 0.0f;
+			for (const Index3 &c : _centers)
+				for (SizeType i = c[0] - 1; i <= c[0] + 1; ++i)
+					for (SizeType j = c[1] - 1; j <= c[1] + 1; ++j)
+						for (SizeType k = c[2] - 1; k <= c[2] + 1; ++k)
+							sum += grid.at(Index3({i, j, k}));
+			bench::keep(sum);
+		}
+
+		Grid<float, 3> _grid;
+		std::vector<Index3> _centers;
+	};
+
+	class RowMajorNeighbourhoods : public LayoutCase {
+	public:
+		void run() override
+		{
+			neighbourhoods(_grid);
+		}
+	};
+
+	template < class G >
+	class ConvertedNeighbourhoods : public LayoutCase {
+	public:
+		bool prepare(const SizeType bytes) override
+		{
+			LayoutCase::prepare(bytes);
+			_converted.reset(new G(_grid));
+			return true;
+		}
+
+		void run() override
+		{
+			neighbourhoods(*_converted);
+		}
+
+		void release() override
+		{
+			LayoutCase::release();
+			_converted.reset();
+		}
+
+	private:
+		std::unique_ptr<G> _converted;
+	};
+
+	typedef ConvertedNeighbourhoods<BrickedGrid<float, 3, 8>> BrickedNeighbourhoods;
+	typedef ConvertedNeighbourhoods<MortonGrid<float, 3>> MortonNeighbourhoods;
+
+	// Row-major to Morton order conversion of the whole grid.
+	class MortonConversion : public LayoutCase {
+	public:
+		void run() override
+		{
+			MortonGrid<float, 3> morton(_grid);
+			bench::keep(morton);
+		}
+
+		SizeType elements() const override
+		{
+			return _grid.size();
+		}
+	};
+
+}
+
+DOPE_BENCHMARK(RowMajorNeighbourhoods, "layout/neighbourhoods/row-major");
+DOPE_BENCHMARK(BrickedNeighbourhoods, "layout/neighbourhoods/bricked");
+DOPE_BENCHMARK(MortonNeighbourhoods, "layout/neighbourhoods/morton");
+DOPE_BENCHMARK(MortonConversion, "layout/morton-conversion");
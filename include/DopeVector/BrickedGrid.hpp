@@ -0,0 +1,256 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef BrickedGrid_hpp
+#define BrickedGrid_hpp
+
+#include <DopeVector/Grid.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The BrickedGrid class describes a D-dimensional grid whose
+	 *        elements are stored in bricks of BrickSize^D elements. Each brick
+	 *        is contiguous in memory, so elements close in any dimension are
+	 *        likely close in memory too. Bricks are stored in row-major order
+	 *        and each one is row-major inside. Each brick can be accessed as a
+	 *        dense DopeVector.
+	 * @param T             Type of the data to be stored.
+	 * @param Dimension     Dimension of the grid.
+	 * @param BrickSize     Side length of a brick. Powers of two make element
+	 *                      access cheaper.
+	 * @param Allocator     Allocator to be used to store the data.
+	 */
+	template < typename T, SizeType Dimension, SizeType BrickSize = 8, class Allocator = std::allocator< T > >
+	class BrickedGrid {
+		static_assert(BrickSize > static_cast<SizeType>(0), "Bricks can not be empty.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>          IndexD;
+		typedef std::vector<T, Allocator> Data;
+
+		static constexpr SizeType BrickVolume = internal::power(BrickSize, Dimension); ///< Number of elements in a brick.
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		inline BrickedGrid();
+
+		/**
+		 *    @brief Initializer contructor.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 */
+		inline explicit BrickedGrid(const IndexD &size, const T &default_value = T());
+
+		/**
+		 *    @brief Conversion contructor.
+		 *    @param o                  The matrix (e.g. a Grid) to copy
+		 *                              sizes and elements from.
+		 */
+		inline explicit BrickedGrid(const DopeVector<T, Dimension> &o);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ACCESS METHODS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & at(const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & at(const IndexD &i);
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & operator[](const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & operator[](const IndexD &i);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BRICKS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Number of bricks the grid is made of.
+		 */
+		inline SizeType brickCount() const;
+
+		/**
+		 *    @brief Number of bricks in each dimension.
+		 */
+		inline const IndexD & allBrickCounts() const;
+
+		/**
+		 *    @brief Gives access to the b-th brick, in row-major brick order.
+		 *    @param b                  The linear index of the brick.
+		 *    @return A dense view of the elements of the brick. Bricks on the
+		 *            upper border are cut to the sizes of the grid.
+		 */
+		inline DopeVector<T, Dimension> brick(const SizeType b) const;
+
+		/**
+		 *    @brief Gives access to the brick at a given brick index.
+		 *    @param b                  The index of the brick, i.e. the index
+		 *                              of any of its elements divided by
+		 *                              BrickSize.
+		 *    @return A dense view of the elements of the brick. Bricks on the
+		 *            upper border are cut to the sizes of the grid.
+		 */
+		inline DopeVector<T, Dimension> brick(const IndexD &b) const;
+
+		/**
+		 *    @brief Index in the grid of the first element of the b-th brick.
+		 *    @param b                  The linear index of the brick.
+		 */
+		inline IndexD brickOrigin(const SizeType b) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERSIONS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Copies all single elements from o to this grid.
+		 *    @param o                  The matrix to copy from.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void import(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copies all single elements of this grid into o.
+		 *    @param o                  The matrix to copy to.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void exportTo(DopeVector<T, Dimension> &o) const;
+
+		/**
+		 *    @brief Convert the bricked grid to a row-major Grid.
+		 *    @param g                  The output grid, resized to the sizes
+		 *                              of this and filled with its elements.
+		 */
+		inline void to_grid(Grid<T, Dimension, Allocator> &g) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the grid, for each dimension.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Size of the grid in a given dimension.
+		 */
+		inline SizeType sizeAt(const SizeType d) const;
+
+		/**
+		 *    @brief Number of elements of the grid, not counting the padding
+		 *           of border bricks.
+		 */
+		inline SizeType size() const;
+
+		/**
+		 *    @brief Check the number of elements in the grid.
+		 *    @return true if the grid has no elements. false otherwise.
+		 */
+		inline bool empty() const;
+
+		/**
+		 *    @brief Give access to the first element of the first brick.
+		 */
+		inline const T * data() const;
+
+		/**
+		 *    @brief Give access to the first element of the first brick.
+		 */
+		inline T * data();
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RESET
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Erase all the grid elements, setting it empty.
+		 */
+		inline void clear();
+
+		/**
+		 *    @brief Resize the container.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 *    @note Data is not kept.
+		 */
+		inline void resize(const IndexD &size, const T &default_value = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		typedef internal::Bounds<BoundsCheckPolicy<T, Dimension>::value> Check;
+
+		IndexD _size;       ///< Sizes of the grid.
+		IndexD _bricks;     ///< Number of bricks in each dimension.
+		Data   _data;       ///< Elements of the grid, brick after brick.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/BrickedGrid.inl>
+
+#endif // BrickedGrid_hpp
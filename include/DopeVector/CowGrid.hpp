@@ -0,0 +1,310 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef CowGrid_hpp
+#define CowGrid_hpp
+
+#include <memory>
+#include <vector>
+#include <DopeVector/Grid.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The CowGrid class describes a D-dimensional grid whose copies
+	 *        share storage until they are written to (copy-on-write). The
+	 *        elements are stored in bricks of BrickSize^D elements, laid out
+	 *        as in BrickedGrid, and both the table of bricks and each brick
+	 *        are shared: copying a CowGrid (or taking a snapshot()) only
+	 *        copies a pointer, the first write after that copies the table of
+	 *        brick pointers, and the first write to a brick copies that brick
+	 *        only.
+	 *
+	 *        A snapshot can be handed to another thread and read there while
+	 *        the original keeps being written, as long as each CowGrid object
+	 *        is used by one thread at a time. References and views to
+	 *        elements obtained for writing are invalidated by the next
+	 *        snapshot, as the following write copies the brick.
+	 * @param T             Type of the data to be stored.
+	 * @param Dimension     Dimension of the grid.
+	 * @param BrickSize     Side length of a brick, the granularity of copies.
+	 */
+	template < typename T, SizeType Dimension, SizeType BrickSize = 8 >
+	class CowGrid {
+		static_assert(BrickSize > static_cast<SizeType>(0), "Bricks can not be empty.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension> IndexD;
+		typedef std::vector<T>   Brick;
+
+		static constexpr SizeType BrickVolume = internal::power(BrickSize, Dimension); ///< Number of elements in a brick.
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		inline CowGrid();
+
+		/**
+		 *    @brief Initializer contructor. All the bricks share a single
+		 *           buffer until they are written to.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 */
+		inline explicit CowGrid(const IndexD &size, const T &default_value = T());
+
+		/**
+		 *    @brief Conversion contructor.
+		 *    @param o                  The matrix (e.g. a Grid) to copy
+		 *                              sizes and elements from.
+		 */
+		inline explicit CowGrid(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copy constructor: shares the storage of o.
+		 */
+		CowGrid(const CowGrid &) = default;
+
+		/**
+		 *    @brief Move constructor. o is left empty.
+		 */
+		inline CowGrid(CowGrid &&o);
+
+		/**
+		 *    @brief Copy assignment operator: shares the storage of o.
+		 */
+		CowGrid & operator=(const CowGrid &) = default;
+
+		/**
+		 *    @brief Move assignment operator. o is left empty.
+		 */
+		inline CowGrid & operator=(CowGrid &&o);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ACCESS METHODS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & at(const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i for writing,
+		 *           copying its brick first if it is shared.
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & at(const IndexD &i);
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & operator[](const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i for writing,
+		 *           copying its brick first if it is shared.
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & operator[](const IndexD &i);
+
+		/**
+		 *    @brief Takes a snapshot of the grid, i.e. a copy sharing its
+		 *           storage. It costs a pointer copy.
+		 */
+		inline CowGrid snapshot() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BRICKS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Number of bricks the grid is made of.
+		 */
+		inline SizeType brickCount() const;
+
+		/**
+		 *    @brief Number of bricks in each dimension.
+		 */
+		inline const IndexD & allBrickCounts() const;
+
+		/**
+		 *    @brief Gives read access to the b-th brick, in row-major brick
+		 *           order.
+		 *    @param b                  The linear index of the brick.
+		 *    @return A dense view of the elements of the brick, which must not
+		 *            be written to, as it may be shared. Bricks on the upper
+		 *            border are cut to the sizes of the grid.
+		 */
+		inline DopeVector<T, Dimension> brick(const SizeType b) const;
+
+		/**
+		 *    @brief Gives write access to the b-th brick, copying it first if
+		 *           it is shared.
+		 *    @param b                  The linear index of the brick.
+		 *    @return A dense view of the elements of the brick. Bricks on the
+		 *            upper border are cut to the sizes of the grid.
+		 */
+		inline DopeVector<T, Dimension> writableBrick(const SizeType b);
+
+		/**
+		 *    @brief Index in the grid of the first element of the b-th brick.
+		 *    @param b                  The linear index of the brick.
+		 */
+		inline IndexD brickOrigin(const SizeType b) const;
+
+		/**
+		 *    @brief Checks whether the b-th brick is shared with other grids
+		 *           (or with other bricks), i.e. writing to it would copy it.
+		 *    @param b                  The linear index of the brick.
+		 */
+		inline bool isShared(const SizeType b) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERSIONS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Copies all single elements from o to this grid. Shared
+		 *           bricks are replaced, without copying their old content.
+		 *    @param o                  The matrix to copy from.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void import(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copies all single elements of this grid into o.
+		 *    @param o                  The matrix to copy to.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void exportTo(DopeVector<T, Dimension> &o) const;
+
+		/**
+		 *    @brief Convert the grid to a row-major Grid.
+		 *    @param g                  The output grid, resized to the sizes
+		 *                              of this and filled with its elements.
+		 */
+		inline void to_grid(Grid<T, Dimension> &g) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the grid, for each dimension.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Size of the grid in a given dimension.
+		 */
+		inline SizeType sizeAt(const SizeType d) const;
+
+		/**
+		 *    @brief Number of elements of the grid, not counting the padding
+		 *           of border bricks.
+		 */
+		inline SizeType size() const;
+
+		/**
+		 *    @brief Check the number of elements in the grid.
+		 *    @return true if the grid has no elements. false otherwise.
+		 */
+		inline bool empty() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RESET
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Erase all the grid elements, setting it empty. Snapshots
+		 *           are not affected.
+		 */
+		inline void clear();
+
+		/**
+		 *    @brief Resize the container. Snapshots are not affected.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 *    @note Data is not kept.
+		 */
+		inline void resize(const IndexD &size, const T &default_value = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		typedef std::vector<std::shared_ptr<Brick>> Table;
+		typedef internal::Bounds<BoundsCheckPolicy<T, Dimension>::value> Check;
+
+		/**
+		 *    @brief Makes the table of bricks owned by this grid only.
+		 */
+		inline Table & ownTable();
+
+		/**
+		 *    @brief Makes the b-th brick owned by this grid only.
+		 */
+		inline Brick & ownBrick(const SizeType b);
+
+		/**
+		 *    @brief Linear index of the brick of element i and index of i
+		 *           in the brick.
+		 */
+		inline void locate(const IndexD &i, SizeType &brick, SizeType &local) const;
+
+		IndexD                 _size;      ///< Sizes of the grid.
+		IndexD                 _bricks;    ///< Number of bricks in each dimension.
+		std::shared_ptr<Table> _table;     ///< Bricks, in row-major brick order.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/CowGrid.inl>
+
+#endif // CowGrid_hpp
@@ -0,0 +1,223 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef DomainDecomposition_hpp
+#define DomainDecomposition_hpp
+
+#include <array>
+#include <vector>
+#include <DopeVector/Grid.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The DomainDecomposition class splits a D-dimensional domain in
+	 *        a regular arrangement of blocks (subdomains), e.g. one per
+	 *        thread. Each subdomain stores its interior surrounded by ghost
+	 *        layers of a given width in a Grid of its own, so that stencils
+	 *        on the interior read the ghosts instead of the neighbours.
+	 *
+	 *        exchange() refreshes the ghost layers (faces, edges and corners)
+	 *        by copying the boundary slabs of the neighbours' interiors, slab
+	 *        by slab with bulk copies, in parallel threads. Along periodic
+	 *        dimensions the first and last subdomains are neighbours; along
+	 *        the others, ghosts outside the domain are never written, so
+	 *        they can hold boundary conditions.
+	 * @param T             Type of the data.
+	 * @param Dimension     Dimension of the domain.
+	 * @param Allocator     Allocator to be used to store the subdomains.
+	 */
+	template < typename T, SizeType Dimension, class Allocator = std::allocator< T > >
+	class DomainDecomposition {
+		static_assert(Dimension > static_cast<SizeType>(1), "Domain decompositions need at least two dimensions.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>                IndexD;
+		typedef Grid<T, Dimension, Allocator>   Local;
+		typedef std::array<bool, Dimension>     Periodicity;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor: no subdomains.
+		 */
+		inline DomainDecomposition();
+
+		/**
+		 *    @brief Initializer constructor. Sizes that do not divide evenly
+		 *           are spread over the first blocks.
+		 *    @param size               Sizes of the domain.
+		 *    @param parts              Number of blocks in each dimension.
+		 *    @param ghost              Width of the ghost layers.
+		 *    @param periodic           Which dimensions are periodic.
+		 *    @param default_value      Default value assigned to the elements,
+		 *                              ghosts included.
+		 *    @throw std::invalid_argument if a dimension has more blocks than
+		 *           elements (or none), or if the ghost layers are wider than
+		 *           a neighbour's interior.
+		 */
+		inline DomainDecomposition(const IndexD &size, const IndexD &parts, const SizeType ghost, const Periodicity &periodic, const T &default_value = T());
+
+		/**
+		 *    @brief Initializer constructor, with the same periodicity in all
+		 *           dimensions.
+		 */
+		inline DomainDecomposition(const IndexD &size, const IndexD &parts, const SizeType ghost, const bool periodic = false, const T &default_value = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SUBDOMAINS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Number of subdomains.
+		 */
+		inline SizeType subdomainCount() const;
+
+		/**
+		 *    @brief Gives the position of a subdomain in the arrangement of
+		 *           blocks.
+		 *    @param k                  The subdomain.
+		 */
+		inline IndexD block(const SizeType k) const;
+
+		/**
+		 *    @brief Gives the index in the domain of the first interior
+		 *           element of a subdomain.
+		 *    @param k                  The subdomain.
+		 */
+		inline IndexD origin(const SizeType k) const;
+
+		/**
+		 *    @brief Gives the sizes of the interior of a subdomain.
+		 *    @param k                  The subdomain.
+		 */
+		inline IndexD interiorSize(const SizeType k) const;
+
+		/**
+		 *    @brief Gives access to a subdomain, ghosts included: its
+		 *           interior starts at index ghostWidth() in each dimension.
+		 *    @param k                  The subdomain.
+		 *    @throw std::out_of_range if k is not a subdomain.
+		 */
+		inline const Local & local(const SizeType k) const;
+		inline Local & local(const SizeType k);
+
+		/**
+		 *    @brief Gives a view of the interior of a subdomain.
+		 *    @param k                  The subdomain.
+		 *    @throw std::out_of_range if k is not a subdomain.
+		 */
+		inline DopeVector<T, Dimension> interior(const SizeType k) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// COPIES
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Copies the interiors of the subdomains from a view of the
+		 *           whole domain, in parallel threads. Ghosts are not changed.
+		 *    @param domain             The view of the domain.
+		 *    @throw std::out_of_range if the sizes do not match.
+		 */
+		inline void load(const DopeVector<T, Dimension> &domain);
+
+		/**
+		 *    @brief Copies the interiors of the subdomains to a view of the
+		 *           whole domain, in parallel threads.
+		 *    @param domain             The view of the domain.
+		 *    @throw std::out_of_range if the sizes do not match.
+		 */
+		inline void store(const DopeVector<T, Dimension> &domain) const;
+
+		/**
+		 *    @brief Copies the boundary slabs of the interiors to the ghost
+		 *           layers of the neighbours, in parallel threads.
+		 */
+		inline void exchange();
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the domain.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Number of blocks in each dimension.
+		 */
+		inline const IndexD & parts() const;
+
+		/**
+		 *    @brief Width of the ghost layers.
+		 */
+		inline SizeType ghostWidth() const;
+
+		/**
+		 *    @brief Which dimensions are periodic.
+		 */
+		inline const Periodicity & periodicity() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		/**
+		 *    @brief Checks that k is a subdomain.
+		 */
+		inline void check(const SizeType k) const;
+
+		IndexD                                       _size;        ///< Sizes of the domain.
+		IndexD                                       _parts;       ///< Blocks in each dimension.
+		SizeType                                     _ghost;       ///< Width of the ghost layers.
+		Periodicity                                  _periodic;    ///< Periodic dimensions.
+		std::array<std::vector<SizeType>, Dimension> _splits;      ///< First index of each block, and the size, in each dimension.
+		std::vector<Local>                           _locals;      ///< The subdomains.
+	};
+
+
+
+	namespace internal {
+
+		/**
+		 * @brief Gives the same periodicity for all dimensions.
+		 */
+		template < SizeType Dimension >
+		inline std::array<bool, Dimension> uniformPeriodicity(const bool periodic);
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/DomainDecomposition.inl>
+
+#endif // DomainDecomposition_hpp
@@ -14,7 +14,13 @@
 #include <sstream>
 #include <stdexcept>
 #include <cstring>
+#include <DopeVector/Instrumentation.hpp>
+#include <DopeVector/Layout.hpp>
+#include <DopeVector/Tracing.hpp>
+#include <DopeVector/internal/BoundsCheck.hpp>
+#include <DopeVector/internal/Equality.hpp>
 #include <DopeVector/internal/Iterator.hpp>
+#include <DopeVector/internal/SubView.hpp>
 
 namespace dope {
 
@@ -35,6 +41,7 @@ namespace dope {
 		typedef Index<Dimension> IndexD;
 		typedef internal::Iterator<T, Dimension, false> iterator;
 		typedef internal::Iterator<T, Dimension, true>  const_iterator;
+		typedef internal::SubView<T, Dimension-1, BoundsCheckPolicy<T, Dimension>::value> SubView;
 
 		////////////////////////////////////////////////////////////////////////
 
@@ -90,8 +97,11 @@ namespace dope {
 
 		/**
 		 *    @brief Default destructor.
+		 *    @note DopeVector has no virtual methods, to be a trivially
+		 *          copyable view: do not delete derived classes (e.g. Grid)
+		 *          through a pointer to DopeVector.
 		 */
-		virtual inline ~DopeVector() = default;
+		~DopeVector() = default;
 
 		////////////////////////////////////////////////////////////////////////
 
@@ -135,13 +145,15 @@ namespace dope {
 		inline void reset(T *array, const SizeType accumulatedOffset, const IndexD &size, const IndexD &offset);
 
 		/**
-		 *    @brief Copies all single elements from o to this matrix.
+		 *    @brief Copies all single elements from o to this matrix. When
+		 *           both are dense (see isContiguous) with the same sizes,
+		 *           this is a single linear copy.
 		 *    @param o                  The matrix to copy from.
 		 *    @note This does not guarantee consistency in case of (partial)
 		 *          memory overlap. If you can not garantee it yourself, then
 		 *          use safeImport.
 		 */
-		virtual inline void import(const DopeVector &o);
+		inline void import(const DopeVector &o);
 
 		/**
 		 *    @brief Copies all single elements from o to this matrix in a
@@ -196,9 +208,11 @@ namespace dope {
 		 *    @brief Gives access to the i-th sub-matrix in the first dimension,
 		 *           i.e. m[i][*]...[*].
 		 *    @param i                  The i-th "row" of this matrix.
-		 *    @return The output sub-matrix at i.
+		 *    @return A lightweight proxy to the sub-matrix at i, which can be
+		 *            indexed further or converted to a DopeVector. It refers
+		 *            to the sizes and offsets of this matrix.
 		 */
-		inline DopeVector<T, Dimension-1> operator[](const SizeType i) const;
+		inline SubView operator[](const SizeType i) const;
 
 		/**
 		 *    @brief Gives access to the element at index i
@@ -214,6 +228,46 @@ namespace dope {
 		 */
 		inline T & operator[](const IndexD &i);
 
+		/**
+		 *    @brief Copies the elements at a batch of indices, in parallel
+		 *           threads for large batches.
+		 *    @param indices            The indices of the elements.
+		 *    @param count              The number of indices.
+		 *    @param out                The output elements, count of them.
+		 */
+		inline void gather(const IndexD *indices, const SizeType count, T *out) const;
+
+		/**
+		 *    @brief Copies the elements at a batch of linear positions (see
+		 *           to_position with the sizes of this matrix), in parallel
+		 *           threads for large batches.
+		 *    @param positions          The positions of the elements.
+		 *    @param count              The number of positions.
+		 *    @param out                The output elements, count of them.
+		 */
+		inline void gather(const SizeType *positions, const SizeType count, T *out) const;
+
+		/**
+		 *    @brief Assigns the elements at a batch of indices.
+		 *    @param indices            The indices of the elements.
+		 *    @param count              The number of indices.
+		 *    @param values             The values to assign, count of them.
+		 *    @note This runs on the calling thread, so that repeated indices
+		 *          keep their last value.
+		 */
+		inline void scatter(const IndexD *indices, const SizeType count, const T *values);
+
+		/**
+		 *    @brief Assigns the elements at a batch of linear positions (see
+		 *           to_position with the sizes of this matrix).
+		 *    @param positions          The positions of the elements.
+		 *    @param count              The number of positions.
+		 *    @param values             The values to assign, count of them.
+		 *    @note This runs on the calling thread, so that repeated positions
+		 *          keep their last value.
+		 */
+		inline void scatter(const SizeType *positions, const SizeType count, const T *values);
+
 		////////////////////////////////////////////////////////////////////////
 
 
@@ -426,6 +480,13 @@ namespace dope {
 		 */
 		inline const IndexD & allOffsets() const;
 
+		/**
+		 *    @brief Gives the layout of this matrix, i.e. its sizes and
+		 *           offsets with precomputed data for converting between
+		 *           indices, positions and memory offsets.
+		 */
+		inline Layout<Dimension> layout() const;
+
 		/**
 		 *    @brief Gives the total size (number of elements in memory) of this
 		 *           matrix.
@@ -433,6 +494,13 @@ namespace dope {
 		 */
 		inline SizeType size() const;
 
+		/**
+		 *    @brief Tells whether the elements of this matrix are stored in a
+		 *           single dense row-major block, i.e. without gaps between
+		 *           rows and with unit offset in the last dimension.
+		 */
+		inline bool isContiguous() const;
+
 		/**
 		 *    @brief Gives the total offset, from the beginning of the stored
 		 *           array, of the i-th element at dimension d.
@@ -461,12 +529,58 @@ namespace dope {
 		// RELATIONAL OPERATORS
 		////////////////////////////////////////////////////////////////////////
 
+		/**
+		 *    @brief Element-wise comparison. Dense rows of BitwiseComparable
+		 *           types are compared with memcmp, large matrixes are split
+		 *           across threads (see DOPE_PARALLEL_GRAIN) and the
+		 *           comparison stops at the first difference found.
+		 *    @return true if sizes and all elements are equal.
+		 */
 		inline bool operator==(const DopeVector &r) const;
 		inline bool operator!=(const DopeVector &r) const;
 
+		/**
+		 *    @brief Finds the first (in row-major order) element where this
+		 *           matrix differs from r.
+		 *    @param r                  The matrix to compare with.
+		 *    @param index              The index of the first difference, if
+		 *                              any.
+		 *    @return true if a difference was found.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline bool firstMismatch(const DopeVector &r, IndexD &index) const;
+
 
 
 	private:
+		typedef internal::Bounds<BoundsCheckPolicy<T, Dimension>::value> Check;
+
+		friend iterator;
+		friend const_iterator;
+
+		/**
+		 *    @brief Gives access to the element at index i, without checking
+		 *           it.
+		 */
+		inline T & element(const IndexD &i) const;
+
+		/**
+		 *    @brief Calls f(n, offset) with the offset from the first element
+		 *           of the n-th of a batch of indices, after checking it, in
+		 *           parallel threads for chunks of at least grain indices.
+		 */
+		template < class F >
+		inline void forEachIndex(const IndexD *indices, const SizeType count, const SizeType grain, F f) const;
+
+		/**
+		 *    @brief Calls f(n, offset) with the offset from the first element
+		 *           of the n-th of a batch of linear positions, after checking
+		 *           it, in parallel threads for chunks of at least grain
+		 *           positions.
+		 */
+		template < class F >
+		inline void forEachPosition(const SizeType *positions, const SizeType count, const SizeType grain, F f) const;
+
 		T       *_array;                 ///< Pointer in memory to the first element of this matrix.
 		SizeType _accumulatedOffset;     ///< Offset of the first element of this matrix from the beginning of the stored array.
 		IndexD   _size;                  ///< Sizes of this matrix, for each dimension.
@@ -620,13 +734,15 @@ namespace dope {
 		DopeVector & operator=(DopeVector &&other) = default;
 
 		/**
-		 *    @brief Copies all single elements from o to this matrix.
+		 *    @brief Copies all single elements from o to this matrix. When
+		 *           both are dense (see isContiguous) with the same sizes,
+		 *           this is a single linear copy.
 		 *    @param o                  The matrix to copy from.
 		 *    @note This does not guarantee consistency in case of (partial)
 		 *          memory overlap. If you can not garantee it yourself, then
 		 *          use safeImport.
 		 */
-		virtual inline void import(const DopeVector &o);
+		inline void import(const DopeVector &o);
 
 		/**
 		 *    @brief Copies all single elements from o to this matrix in a
@@ -702,6 +818,46 @@ namespace dope {
 		 */
 		inline T & operator[](const Index1 i);
 
+		/**
+		 *    @brief Copies the elements at a batch of indices, in parallel
+		 *           threads for large batches.
+		 *    @param indices            The indices of the elements.
+		 *    @param count              The number of indices.
+		 *    @param out                The output elements, count of them.
+		 */
+		inline void gather(const Index1 *indices, const SizeType count, T *out) const;
+
+		/**
+		 *    @brief Copies the elements at a batch of linear positions (see
+		 *           to_position with the sizes of this matrix), in parallel
+		 *           threads for large batches.
+		 *    @param positions          The positions of the elements.
+		 *    @param count              The number of positions.
+		 *    @param out                The output elements, count of them.
+		 */
+		inline void gather(const SizeType *positions, const SizeType count, T *out) const;
+
+		/**
+		 *    @brief Assigns the elements at a batch of indices.
+		 *    @param indices            The indices of the elements.
+		 *    @param count              The number of indices.
+		 *    @param values             The values to assign, count of them.
+		 *    @note This runs on the calling thread, so that repeated indices
+		 *          keep their last value.
+		 */
+		inline void scatter(const Index1 *indices, const SizeType count, const T *values);
+
+		/**
+		 *    @brief Assigns the elements at a batch of linear positions (see
+		 *           to_position with the sizes of this matrix).
+		 *    @param positions          The positions of the elements.
+		 *    @param count              The number of positions.
+		 *    @param values             The values to assign, count of them.
+		 *    @note This runs on the calling thread, so that repeated positions
+		 *          keep their last value.
+		 */
+		inline void scatter(const SizeType *positions, const SizeType count, const T *values);
+
 		////////////////////////////////////////////////////////////////////////
 
 
@@ -889,6 +1045,12 @@ namespace dope {
 		 */
 		inline SizeType size() const;
 
+		/**
+		 *    @brief Tells whether the elements of this vector are stored one
+		 *           after the other, i.e. with unit offset.
+		 */
+		inline bool isContiguous() const;
+
 		/**
 		 *    @brief Gives the offset of the elements in the d dimension.
 		 *    @param d                  The dimension whose offset is requested
@@ -909,6 +1071,13 @@ namespace dope {
 		 */
 		inline const Index1 & allOffsets() const;
 
+		/**
+		 *    @brief Gives the layout of this matrix, i.e. its sizes and
+		 *           offsets with precomputed data for converting between
+		 *           indices, positions and memory offsets.
+		 */
+		inline Layout<1> layout() const;
+
 		/**
 		 *    @brief Gives the total offset, from the beginning of the stored
 		 *           array, of the i-th element.
@@ -935,12 +1104,40 @@ namespace dope {
 		// RELATIONAL OPERATORS
 		////////////////////////////////////////////////////////////////////////
 
+		/**
+		 *    @brief Element-wise comparison. Dense vectors of
+		 *           BitwiseComparable types are compared with memcmp, large
+		 *           vectors are split across threads (see DOPE_PARALLEL_GRAIN)
+		 *           and the comparison stops at the first difference found.
+		 *    @return true if sizes and all elements are equal.
+		 */
 		inline bool operator==(const DopeVector &r) const;
 		inline bool operator!=(const DopeVector &r) const;
 
+		/**
+		 *    @brief Finds the first element where this vector differs from r.
+		 *    @param r                  The vector to compare with.
+		 *    @param index              The index of the first difference, if
+		 *                              any.
+		 *    @return true if a difference was found.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline bool firstMismatch(const DopeVector &r, Index1 &index) const;
+
 
 
 	private:
+		typedef internal::Bounds<BoundsCheckPolicy<T, 1>::value> Check;
+
+		friend iterator;
+		friend const_iterator;
+
+		/**
+		 *    @brief Gives access to the element at index i, without checking
+		 *           it.
+		 */
+		inline T & element(const Index1 &i) const;
+
 		T       *_array;                 ///< Pointer in memory to the first element of this vector.
 		SizeType _accumulatedOffset;     ///< Offset of the first element of this vector from the beginning of the stored array.
 		Index1   _size;                  ///< Sizes of this matrix, for each dimension.
@@ -114,7 +114,7 @@ namespace dope {
 		/**
 		 *    @brief Default destructor.
 		 */
-		virtual inline ~Grid();
+		inline ~Grid();
 
 		////////////////////////////////////////////////////////////////////////
 
@@ -364,19 +364,22 @@ namespace dope {
 		 */
 		inline Grid & operator=(Grid &&o) = default;
 
-#ifdef DOPE_USE_RTTI
+		using DopeVector<T, Dimension>::import;
+
 		/**
-		 *    @brief Copies all single elements from o to this matrix.
-		 *    @param o                  The matrix to copy from.
+		 *    @brief Copies all single elements from o to this grid. Being
+		 *           chosen at compile time, this overload copies the whole
+		 *           buffer when o has the same layout as this.
+		 *    @param o                  The grid to copy from.
+		 *    @throw std::out_of_range if sizes do not match.
 		 */
-		inline void import(const DopeVector<T, Dimension> &o) override;
-#endif
+		inline void import(const Grid &o);
 
 		/**
 		 *    @brief Swap this with a given grid.
 		 *    @note Swap operation is performend in O( 1 ).
 		 */
-		virtual inline void swap(Grid &o);
+		inline void swap(Grid &o);
 
 		////////////////////////////////////////////////////////////////////////
 
@@ -386,6 +389,13 @@ namespace dope {
 	private:
 		// hyde some methods from DopeVector
 		using DopeVector<T, Dimension>::reset;
+
+		/**
+		 *    @brief Copy constructs the elements of another grid, accounting
+		 *           the copy, so that the copy constructor can do it in its
+		 *           member initializer list.
+		 */
+		static inline Data copyData(const Data &data);
 	};
 
 
@@ -0,0 +1,211 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Hash_hpp
+#define Hash_hpp
+
+#include <cstdint>
+#include <vector>
+#include <DopeVector/DopeVector.hpp>
+
+/**
+ * Number of bytes of elements hashed into each leaf of a content hash. The
+ * value is part of the definition of the hash: hashes computed with different
+ * leaf sizes do not match.
+ */
+#ifndef DOPE_HASH_LEAF_BYTES
+	#define DOPE_HASH_LEAF_BYTES (dope::SizeType(1) << 16)
+#endif
+
+namespace dope {
+
+	/**
+	 * @brief A 128 bits hash value.
+	 */
+	struct Hash128 {
+		std::uint64_t low;      ///< Lower 64 bits, which are also the 64 bits hash.
+		std::uint64_t high;     ///< Upper 64 bits.
+
+		inline bool operator==(const Hash128 &o) const { return low == o.low && high == o.high; }
+		inline bool operator!=(const Hash128 &o) const { return !(*this == o); }
+	};
+
+	/**
+	 * @brief Computes a 64 bits hash of the content of a view.
+	 *
+	 *        The hash depends on the sizes of the view and on the bytes of its
+	 *        elements in row-major order only, so any view (e.g. a window())
+	 *        and a dense copy of it hash the same. It is not a cryptographic
+	 *        hash, and elements are hashed by their bytes: equal floating
+	 *        point values with different representations (0.0 and -0.0, NaNs)
+	 *        give different hashes.
+	 *
+	 *        The elements are split into leaves of DOPE_HASH_LEAF_BYTES bytes,
+	 *        hashed in parallel when the view is large (see
+	 *        DOPE_PARALLEL_GRAIN), and the leaf hashes are combined into the
+	 *        result.
+	 * @param view          The view to hash.
+	 * @param seed          Seed of the hash.
+	 */
+	template < typename T, SizeType Dimension >
+	inline std::uint64_t contentHash(const DopeVector<T, Dimension> &view, const std::uint64_t seed = 0);
+
+	/**
+	 * @brief Computes a 128 bits hash of the content of a view, like
+	 *        contentHash. Its lower half is the 64 bits hash.
+	 */
+	template < typename T, SizeType Dimension >
+	inline Hash128 contentHash128(const DopeVector<T, Dimension> &view, const std::uint64_t seed = 0);
+
+
+
+	/**
+	 * @brief The ContentHash class keeps the hash of a view up to date as
+	 *        blocks of it change, rehashing only the leaves that the changed
+	 *        blocks touch. Its value is the same as contentHash128 of the
+	 *        view.
+	 * @param T             Type of the data.
+	 * @param Dimension     Dimension of the data.
+	 */
+	template < typename T, SizeType Dimension >
+	class ContentHash {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension> IndexD;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Initializer constructor: hashes the whole view.
+		 *    @param view               The view to hash. Its data must outlive
+		 *                              this object.
+		 *    @param seed               Seed of the hash.
+		 */
+		inline explicit ContentHash(const DopeVector<T, Dimension> &view, const std::uint64_t seed = 0);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// UPDATE
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Rehashes the whole view.
+		 */
+		inline void update();
+
+		/**
+		 *    @brief Rehashes the leaves touched by a changed block of the view.
+		 *    @param start              Index of the first element of the block.
+		 *    @param size               Sizes of the block.
+		 *    @throw std::out_of_range if the block exceeds the view.
+		 */
+		inline void update(const IndexD &start, const IndexD &size);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief The 64 bits hash of the view.
+		 */
+		inline std::uint64_t value() const;
+
+		/**
+		 *    @brief The 128 bits hash of the view.
+		 */
+		inline const Hash128 & value128() const;
+
+		/**
+		 *    @brief Number of leaves the view is split into.
+		 */
+		inline SizeType leafCount() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		DopeVector<T, Dimension>    _view;      ///< The hashed view.
+		std::uint64_t               _seed;      ///< Seed of the hash.
+		std::vector<Hash128>        _leaves;    ///< Hashes of the leaves.
+		Hash128                     _value;     ///< Combined hash.
+	};
+
+
+
+	namespace internal {
+
+		/**
+		 * @brief The HashState class is a streaming 64 bits hash in the style
+		 *        of xxHash64, processing 32 bytes per step in four independent
+		 *        lanes, extended with a second output for 128 bits hashes.
+		 */
+		class HashState {
+		public:
+			inline explicit HashState(const std::uint64_t seed);
+
+			/**
+			 * @brief Appends bytes to the hashed stream.
+			 */
+			inline void update(const void *data, const SizeType bytes);
+
+			/**
+			 * @brief Gives the hash of the bytes appended so far.
+			 */
+			inline Hash128 digest() const;
+
+		private:
+			std::uint64_t   _lanes[4];      ///< Accumulators of the four lanes.
+			std::uint64_t   _seed;          ///< Seed of the hash.
+			std::uint64_t   _length;        ///< Number of bytes appended.
+			unsigned char   _buffer[32];    ///< Bytes not yet forming a step.
+			SizeType        _buffered;      ///< Number of bytes in _buffer.
+		};
+
+		/**
+		 * @brief Number of elements of type T per leaf.
+		 */
+		template < typename T >
+		constexpr SizeType hashLeafElements();
+
+		/**
+		 * @brief Hashes the leaf-th leaf of the row-major elements of a view.
+		 */
+		template < typename T, SizeType Dimension >
+		inline Hash128 hashLeaf(const DopeVector<T, Dimension> &view, const SizeType leaf, const std::uint64_t seed);
+
+		/**
+		 * @brief Combines the sizes of a view and the hashes of its leaves.
+		 */
+		template < typename T, SizeType Dimension >
+		inline Hash128 combineLeaves(const Index<Dimension> &size, const std::vector<Hash128> &leaves, const std::uint64_t seed);
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/Hash.inl>
+
+#endif // Hash_hpp
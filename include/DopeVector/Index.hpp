@@ -309,6 +309,52 @@ namespace dope {
 	template < SizeType Dimension >
 	static inline Index<Dimension> to_indexFromOffset(const SizeType position, const Index<Dimension> &offset);
 
+	/**
+	 * @brief Linearizes a batch of indices, according to the given range.
+	 *        The jumps of the range are computed once, and each position is a
+	 *        multiply-add chain the compiler can vectorize.
+	 * @param indices       The indices to be linearized.
+	 * @param count         The number of indices.
+	 * @param range         The range of the linearization.
+	 * @param positions     The output positions, count of them.
+	 */
+	template < SizeType Dimension >
+	static inline void to_positions(const Index<Dimension> *indices, const SizeType count, const Index<Dimension> &range, SizeType *positions);
+
+	/**
+	 * @brief Linearizes a batch of indices, according to the given offset.
+	 * @param indices       The indices to be linearized.
+	 * @param count         The number of indices.
+	 * @param offset        The offset in each dimension.
+	 * @param positions     The output positions, count of them.
+	 */
+	template < SizeType Dimension >
+	static inline void to_positionsFromOffset(const Index<Dimension> *indices, const SizeType count, const Index<Dimension> &offset, SizeType *positions);
+
+	/**
+	 * @brief Puts a batch of linear positions in index form, according to
+	 *        the given range. Divisions by the sizes are multiplications by
+	 *        inverses computed once.
+	 * @param positions     The positions to be put in index form.
+	 * @param count         The number of positions.
+	 * @param range         The range of the indices.
+	 * @param indices       The output indices, count of them.
+	 */
+	template < SizeType Dimension >
+	static inline void to_indices(const SizeType *positions, const SizeType count, const Index<Dimension> &range, Index<Dimension> *indices);
+
+	/**
+	 * @brief Puts a batch of linear positions in index form, according to
+	 *        the given offset. The dimensions are sorted by offset, and the
+	 *        inverses of the offsets computed, once for the whole batch.
+	 * @param positions     The positions to be put in index form.
+	 * @param count         The number of positions.
+	 * @param offset        The offset in each dimension.
+	 * @param indices       The output indices, count of them.
+	 */
+	template < SizeType Dimension >
+	static inline void to_indicesFromOffset(const SizeType *positions, const SizeType count, const Index<Dimension> &offset, Index<Dimension> *indices);
+
 	////////////////////////////////////////////////////////////////////////
 
 }
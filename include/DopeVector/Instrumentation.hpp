@@ -0,0 +1,146 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Instrumentation_hpp
+#define Instrumentation_hpp
+
+#include <array>
+#include <cstdint>
+#include <DopeVector/internal/Common.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The Operation enumeration lists the operations whose cost is
+	 *        accounted when DOPE_USE_INSTRUMENTATION is defined.
+	 */
+	enum class Operation {
+		Import = 0,             ///< DopeVector::import and Grid::import.
+		SafeImport,             ///< DopeVector::safeImport.
+		GridCopy,               ///< Grid copy construction and copy assignment.
+		ConservativeResize,     ///< Grid::conservativeResize.
+		Count                   ///< Number of operations, not an operation.
+	};
+
+	/**
+	 * @brief Costs accounted to an operation.
+	 */
+	struct OperationCounters {
+		std::uint64_t calls;            ///< Number of (outermost) calls.
+		std::uint64_t elements;         ///< Number of elements visited.
+		std::uint64_t bytes;            ///< Number of bytes copied.
+		std::uint64_t allocations;      ///< Number of buffers allocated.
+		std::uint64_t nanoseconds;      ///< Time spent in the calls.
+	};
+
+	/**
+	 * @brief The Instrumentation class gives access to the counters of the
+	 *        calling thread. Each thread counts on its own, without
+	 *        synchronization: take a snapshot in every thread of interest
+	 *        and sum them if a global figure is needed.
+	 *
+	 *        Counters are only updated when DOPE_USE_INSTRUMENTATION is
+	 *        defined (with cmake, -DWITH_INSTRUMENTATION=ON); otherwise the
+	 *        accounting compiles to nothing and snapshots are all zeros.
+	 *
+	 *        An operation invoked by another one (e.g. the imports of
+	 *        safeImport or conservativeResize) is accounted to the outermost
+	 *        one only.
+	 */
+	class Instrumentation {
+	public:
+		typedef std::array<OperationCounters, static_cast<SizeType>(Operation::Count)> Snapshot;
+
+		/**
+		 *    @brief Tells whether counters are updated in this build.
+		 */
+		static constexpr bool enabled();
+
+		/**
+		 *    @brief Gives the current counters of the calling thread, indexed
+		 *           by Operation.
+		 */
+		static inline Snapshot snapshot();
+
+		/**
+		 *    @brief Gives the counters of an operation of the calling thread.
+		 */
+		static inline OperationCounters counters(const Operation op);
+
+		/**
+		 *    @brief Zeroes the counters of the calling thread.
+		 */
+		static inline void reset();
+
+		/**
+		 *    @brief Gives a printable name of an operation, e.g. for metric
+		 *           labels.
+		 */
+		static inline const char * name(const Operation op);
+	};
+
+	namespace internal {
+
+		/**
+		 * @brief Counters of a thread and the operation currently accounted.
+		 */
+		struct InstrumentationState {
+			Instrumentation::Snapshot counters;
+			Operation current;
+			SizeType depth;
+		};
+
+		inline InstrumentationState & instrumentationState();
+
+		/**
+		 * @brief The InstrumentationScope class accounts a call and its
+		 *        duration to an operation, unless another operation is
+		 *        already being accounted in the calling thread.
+		 */
+		class InstrumentationScope {
+		public:
+			inline explicit InstrumentationScope(const Operation op);
+			inline ~InstrumentationScope();
+
+			InstrumentationScope(const InstrumentationScope &) = delete;
+			InstrumentationScope & operator=(const InstrumentationScope &) = delete;
+
+		private:
+			std::int64_t _start;        ///< Start time in nanoseconds, if outermost.
+		};
+
+		/**
+		 * @brief Accounts elements (and their bytes) copied by the current
+		 *        operation, if any.
+		 */
+		inline void instrumentCopy(const SizeType elements, const SizeType bytes);
+
+		/**
+		 * @brief Accounts an allocation made by the current operation, if any.
+		 */
+		inline void instrumentAllocation();
+
+	}
+
+}
+
+#ifdef DOPE_USE_INSTRUMENTATION
+	#define DOPE_INSTRUMENT_SCOPE(op) ::dope::internal::InstrumentationScope dope_instrumentation_scope_(op)
+	#define DOPE_INSTRUMENT_COPY(elements, bytes) ::dope::internal::instrumentCopy(elements, bytes)
+	#define DOPE_INSTRUMENT_ALLOCATION() ::dope::internal::instrumentAllocation()
+#else
+	#define DOPE_INSTRUMENT_SCOPE(op)
+	#define DOPE_INSTRUMENT_COPY(elements, bytes) ((void)0)
+	#define DOPE_INSTRUMENT_ALLOCATION() ((void)0)
+#endif
+
+#include <DopeVector/internal/inlines/Instrumentation.inl>
+
+#endif // Instrumentation_hpp
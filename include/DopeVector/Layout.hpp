@@ -0,0 +1,166 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Layout_hpp
+#define Layout_hpp
+
+#include <array>
+#include <DopeVector/Index.hpp>
+#include <DopeVector/internal/Divider.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The Layout class describes how the elements of a D-dimensional
+	 *        matrix are placed in memory, given its sizes and offsets, with
+	 *        the data needed to map between indices, row-major positions and
+	 *        memory offsets computed once: the order of the dimensions by
+	 *        offset, which dimensions are packed, and multiplicative inverses
+	 *        for the divisions by each size and offset. A DopeVector gives
+	 *        its layout with layout(); build it once and reuse it for many
+	 *        conversions.
+	 * @param Dimension     Dimension of the matrix.
+	 */
+	template < SizeType Dimension >
+	class Layout {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension> IndexD;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor: no elements.
+		 */
+		inline Layout();
+
+		/**
+		 *    @brief Initializer constructor of a dense row-major layout.
+		 *    @param size               Sizes of the matrix.
+		 */
+		inline explicit Layout(const IndexD &size);
+
+		/**
+		 *    @brief Initializer constructor.
+		 *    @param size               Sizes of the matrix.
+		 *    @param offset             Offsets in each dimension, i.e. jumps in
+		 *                              memory.
+		 */
+		inline Layout(const IndexD &size, const IndexD &offset);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERSIONS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives the row-major position of an index.
+		 */
+		inline SizeType to_position(const IndexD &index) const;
+
+		/**
+		 *    @brief Gives the index of a row-major position.
+		 */
+		inline IndexD to_index(const SizeType position) const;
+
+		/**
+		 *    @brief Gives the memory offset of an index.
+		 */
+		inline SizeType to_offset(const IndexD &index) const;
+
+		/**
+		 *    @brief Gives the memory offset of a row-major position. It is the
+		 *           position itself for dense row-major layouts.
+		 */
+		inline SizeType to_offset(const SizeType position) const;
+
+		/**
+		 *    @brief Gives the index of a memory offset, as to_indexFromOffset
+		 *           does, without sorting the offsets.
+		 */
+		inline IndexD to_indexFromOffset(const SizeType offset) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the matrix.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Offsets of the matrix.
+		 */
+		inline const IndexD & allOffsets() const;
+
+		/**
+		 *    @brief Number of elements.
+		 */
+		inline SizeType size() const;
+
+		/**
+		 *    @brief The dimensions by decreasing offset.
+		 */
+		inline const IndexD & order() const;
+
+		/**
+		 *    @brief Tells whether the elements along dimension d are packed
+		 *           right after each other's following dimensions, i.e. the
+		 *           offset of d is the product of the following sizes (or d
+		 *           has at most one element).
+		 */
+		inline bool isContiguous(const SizeType d) const;
+
+		/**
+		 *    @brief Tells whether the layout is dense and row-major, i.e. all
+		 *           the dimensions are contiguous.
+		 */
+		inline bool isContiguous() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		/**
+		 *    @brief Gives the offsets of a dense row-major layout.
+		 */
+		static inline IndexD denseOffsets(const IndexD &size);
+
+		IndexD                                    _size;          ///< Sizes of the matrix.
+		IndexD                                    _offset;        ///< Offsets of the matrix.
+		IndexD                                    _order;         ///< Dimensions by decreasing offset.
+		std::array<bool, Dimension>               _contiguous;    ///< Contiguity of each dimension.
+		bool                                      _dense;         ///< Contiguity of all dimensions.
+		std::array<internal::Divider, Dimension>  _bySize;        ///< Divisions by the sizes.
+		std::array<internal::Divider, Dimension>  _byOffset;      ///< Divisions by the offsets, in order.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/Layout.inl>
+
+#endif // Layout_hpp
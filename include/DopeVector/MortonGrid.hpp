@@ -0,0 +1,259 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef MortonGrid_hpp
+#define MortonGrid_hpp
+
+#include <cstdint>
+#include <DopeVector/Grid.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		/**
+		 * @brief Scatters the low bits of value to the positions of the set
+		 *        bits of mask, i.e. the BMI2 pdep instruction.
+		 */
+		inline std::uint64_t deposit_bits(const std::uint64_t value, const std::uint64_t mask);
+
+		/**
+		 * @brief Gathers the bits of value at the positions of the set bits
+		 *        of mask into the low bits of the result, i.e. the BMI2 pext
+		 *        instruction.
+		 */
+		inline std::uint64_t extract_bits(const std::uint64_t value, const std::uint64_t mask);
+
+	}
+
+	/**
+	 * @brief The MortonGrid class describes a D-dimensional grid whose
+	 *        elements are stored in Z-order (Morton order), i.e. at the
+	 *        position obtained interleaving the bits of their index
+	 *        components. Elements close in any dimension are then likely
+	 *        close in memory too. Sizes must be powers of two, possibly
+	 *        different from each other.
+	 * @param T             Type of the data to be stored.
+	 * @param Dimension     Dimension of the grid.
+	 * @param Allocator     Allocator to be used to store the data.
+	 * @note Encoding uses the BMI2 pdep/pext instructions when compiled
+	 *       for a target supporting them (e.g. -mbmi2), a portable loop
+	 *       otherwise.
+	 */
+	template < typename T, SizeType Dimension, class Allocator = std::allocator< T > >
+	class MortonGrid {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>          IndexD;
+		typedef std::vector<T, Allocator> Data;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		inline MortonGrid();
+
+		/**
+		 *    @brief Initializer contructor.
+		 *    @param size               Sizes of the D-dimensional grid. Each
+		 *                              one must be a power of two.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 *    @throw std::invalid_argument if a size is not a power of two.
+		 */
+		inline explicit MortonGrid(const IndexD &size, const T &default_value = T());
+
+		/**
+		 *    @brief Conversion contructor.
+		 *    @param o                  The matrix (e.g. a Grid) to copy
+		 *                              sizes and elements from.
+		 *    @throw std::invalid_argument if a size is not a power of two.
+		 */
+		inline explicit MortonGrid(const DopeVector<T, Dimension> &o);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ENCODING
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Computes the Morton code of an index.
+		 *    @param i                  The index of an element.
+		 *    @return The position of the element in memory.
+		 */
+		inline SizeType encode(const IndexD &i) const;
+
+		/**
+		 *    @brief Computes the index of a Morton code.
+		 *    @param code               The position of an element in memory.
+		 *    @return The index of the element.
+		 */
+		inline IndexD decode(const SizeType code) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ACCESS METHODS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & at(const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & at(const IndexD &i);
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & operator[](const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & operator[](const IndexD &i);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERSIONS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Copies all single elements from o to this grid.
+		 *    @param o                  The matrix to copy from.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void import(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copies all single elements of this grid into o.
+		 *    @param o                  The matrix to copy to.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void exportTo(DopeVector<T, Dimension> &o) const;
+
+		/**
+		 *    @brief Convert the Morton grid to a row-major Grid.
+		 *    @param g                  The output grid, resized to the sizes
+		 *                              of this and filled with its elements.
+		 */
+		inline void to_grid(Grid<T, Dimension, Allocator> &g) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the grid, for each dimension.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Size of the grid in a given dimension.
+		 */
+		inline SizeType sizeAt(const SizeType d) const;
+
+		/**
+		 *    @brief Number of elements of the grid.
+		 */
+		inline SizeType size() const;
+
+		/**
+		 *    @brief Check the number of elements in the grid.
+		 *    @return true if the grid has no elements. false otherwise.
+		 */
+		inline bool empty() const;
+
+		/**
+		 *    @brief Give access to the element with Morton code 0.
+		 */
+		inline const T * data() const;
+
+		/**
+		 *    @brief Give access to the element with Morton code 0.
+		 */
+		inline T * data();
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RESET
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Erase all the grid elements, setting it empty.
+		 */
+		inline void clear();
+
+		/**
+		 *    @brief Resize the container.
+		 *    @param size               Sizes of the D-dimensional grid. Each
+		 *                              one must be a power of two.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 *    @throw std::invalid_argument if a size is not a power of two.
+		 *    @note Data is not kept.
+		 */
+		inline void resize(const IndexD &size, const T &default_value = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		typedef internal::Bounds<BoundsCheckPolicy<T, Dimension>::value> Check;
+
+		template < class F >
+		inline void forEachRow(const DopeVector<T, Dimension> &o, F f) const;
+
+		IndexD                                  _size;  ///< Sizes of the grid.
+		std::array<std::uint64_t, Dimension>    _masks; ///< Bits of the Morton code taken by each dimension.
+		Data                                    _data;  ///< Elements of the grid, in Morton order.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/MortonGrid.inl>
+
+#endif // MortonGrid_hpp
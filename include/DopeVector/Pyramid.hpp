@@ -0,0 +1,184 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Pyramid_hpp
+#define Pyramid_hpp
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include <DopeVector/Grid.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The Pyramid class describes a chain of grids at halving
+	 *        resolution (a mipmap, or the levels of an octree), built from a
+	 *        finest level. Each element of a level is computed from its up to
+	 *        2^D children in the previous level, by averaging them (box
+	 *        filter) or by a custom kernel. Odd sizes are rounded up, so
+	 *        parents on the upper border have fewer children.
+	 *
+	 *        The finest level is not copied: the pyramid keeps a view of it,
+	 *        which must stay valid, and the coarser levels are Grids. After a
+	 *        region of the finest level changes, update() recomputes only the
+	 *        elements that depend on it.
+	 * @param T             Type of the data. The box filter needs an
+	 *                      arithmetic type; other types need a kernel.
+	 * @param Dimension     Dimension of the grids.
+	 * @param Allocator     Allocator to be used to store the coarser levels.
+	 */
+	template < typename T, SizeType Dimension, class Allocator = std::allocator< T > >
+	class Pyramid {
+		static_assert(Dimension > static_cast<SizeType>(1), "Pyramids need at least two dimensions.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>                                   IndexD;
+		typedef Grid<T, Dimension, Allocator>                      Level;
+
+		/**
+		 * @brief A kernel computes an element from the view of its children.
+		 *        It may be called from several threads at once.
+		 */
+		typedef std::function<T(const DopeVector<T, Dimension> &children)> Kernel;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		inline Pyramid();
+
+		/**
+		 *    @brief Initializer constructor: builds a pyramid with a box
+		 *           filter.
+		 *    @param finest             The finest level.
+		 *    @param levels             Number of levels, finest included. 0
+		 *                              builds levels down to a single element.
+		 */
+		inline explicit Pyramid(const DopeVector<T, Dimension> &finest, const SizeType levels = 0);
+
+		/**
+		 *    @brief Initializer constructor: builds a pyramid with a custom
+		 *           kernel.
+		 *    @param finest             The finest level.
+		 *    @param kernel             The kernel computing a parent from its
+		 *                              children.
+		 *    @param levels             Number of levels, finest included. 0
+		 *                              builds levels down to a single element.
+		 */
+		inline Pyramid(const DopeVector<T, Dimension> &finest, Kernel kernel, const SizeType levels = 0);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// LEVELS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Number of levels, finest included.
+		 */
+		inline SizeType levelCount() const;
+
+		/**
+		 *    @brief Gives access to a level.
+		 *    @param k                  The level, 0 being the finest.
+		 *    @return A view of the level.
+		 */
+		inline DopeVector<T, Dimension> level(const SizeType k) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// UPDATE
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Recomputes all the coarser levels.
+		 */
+		inline void rebuild();
+
+		/**
+		 *    @brief Recomputes the elements of the coarser levels depending on
+		 *           a changed window of the finest level.
+		 *    @param start              Index of the first element of the
+		 *                              window.
+		 *    @param size               Sizes of the window.
+		 *    @throw std::out_of_range if the window exceeds the finest level.
+		 */
+		inline void update(const IndexD &start, const IndexD &size);
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		/**
+		 *    @brief Computes the parents in the window [start, start+size) of
+		 *           level k from level k-1.
+		 */
+		inline void reduce(const SizeType k, const IndexD &start, const IndexD &size);
+
+		DopeVector<T, Dimension>   _finest;    ///< The finest level.
+		std::vector<Level>         _levels;    ///< The coarser levels.
+		Kernel                     _kernel;    ///< The custom kernel, if any.
+	};
+
+
+
+	namespace internal {
+
+		/**
+		 * @brief Type accumulating the sum of the children of the box filter.
+		 */
+		template < typename T >
+		struct BoxAccumulator {
+			typedef typename std::conditional<std::is_floating_point<T>::value, T,
+			        typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type>::type type;
+		};
+
+		/**
+		 * @brief Averages the up to 2^D children of each element of dst,
+		 *        row by row along the last dimension, in parallel threads.
+		 * @param src           The children, sizes at most 2 * sizes of dst.
+		 * @param dst           The parents.
+		 */
+		template < typename T, SizeType Dimension >
+		inline void boxDownsample(const DopeVector<T, Dimension> &src, const DopeVector<T, Dimension> &dst, std::true_type arithmetic);
+
+		template < typename T, SizeType Dimension >
+		inline void boxDownsample(const DopeVector<T, Dimension> &src, const DopeVector<T, Dimension> &dst, std::false_type arithmetic);
+
+		/**
+		 * @brief Computes each element of dst with a kernel on its children,
+		 *        in parallel threads.
+		 */
+		template < typename T, SizeType Dimension, class Kernel >
+		inline void kernelDownsample(const DopeVector<T, Dimension> &src, const DopeVector<T, Dimension> &dst, const Kernel &kernel);
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/Pyramid.inl>
+
+#endif // Pyramid_hpp
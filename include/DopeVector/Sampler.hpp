@@ -0,0 +1,170 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Sampler_hpp
+#define Sampler_hpp
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <DopeVector/DopeVector.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The Interpolation enumeration lists the ways a Sampler computes
+	 *        values between elements.
+	 */
+	enum class Interpolation {
+		Nearest,        ///< The nearest element.
+		Linear,         ///< Multi-linear interpolation of the 2^D surrounding elements.
+		Cubic           ///< Catmull-Rom interpolation of the 4^D surrounding elements.
+	};
+
+	/**
+	 * @brief The Border enumeration lists how a Sampler treats elements
+	 *        outside the view.
+	 */
+	enum class Border {
+		Clamp,          ///< The nearest element of the view is used.
+		Repeat,         ///< The view is repeated periodically.
+		Constant        ///< A constant value is used.
+	};
+
+	/**
+	 * @brief The Sampler class interpolates the elements of a view at
+	 *        fractional coordinates, where element i is at coordinate i. The
+	 *        view origin, sizes and strides are cached on construction, so any
+	 *        view works, including windows and permutations; the sampler must
+	 *        be rebuilt if the view is reset.
+	 *
+	 *        Batches of points are processed in blocks: the integer indices
+	 *        and fractions of a block are computed dimension by dimension in
+	 *        loops the compiler can vectorize, then the elements are gathered
+	 *        and weighted point by point. Large batches are split across
+	 *        threads (see DOPE_PARALLEL_GRAIN).
+	 * @param T             Type of the data. It must support addition and
+	 *                      multiplication by Real, unless it is integral, in
+	 *                      which case values are interpolated as Real,
+	 *                      rounded to nearest and clamped to the range of T.
+	 * @param Dimension     Dimension of the data.
+	 * @param Real          Type of the coordinates and weights.
+	 */
+	template < typename T, SizeType Dimension, typename Real = float >
+	class Sampler {
+		static_assert(std::is_floating_point<Real>::value, "Coordinates must be floating point.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef std::array<Real, Dimension> Point;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Initializer constructor.
+		 *    @param view               The view to sample. Its data must
+		 *                              outlive the sampler.
+		 *    @param interpolation      How to interpolate between elements.
+		 *    @param border             How to treat elements outside the view.
+		 *    @param border_value       The value outside the view, for
+		 *                              Border::Constant or empty views.
+		 */
+		inline explicit Sampler(const DopeVector<T, Dimension> &view, const Interpolation interpolation = Interpolation::Linear, const Border border = Border::Clamp, const T &border_value = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// SAMPLING
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Samples the view at a point.
+		 *    @param p                  The coordinates, one per dimension.
+		 *    @return The interpolated value.
+		 */
+		inline T operator()(const Point &p) const;
+
+		/**
+		 *    @brief Samples the view at a batch of points.
+		 *    @param points             The points.
+		 *    @param count              The number of points.
+		 *    @param out                The output values, count of them.
+		 */
+		inline void sample(const Point *points, const SizeType count, T *out) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief The interpolation in use.
+		 */
+		inline Interpolation interpolation() const;
+
+		/**
+		 *    @brief The border treatment in use.
+		 */
+		inline Border border() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		typedef typename std::conditional<std::is_integral<T>::value, Real, T>::type Accum;
+
+		static constexpr SizeType Block = 64;                               ///< Points whose indices are computed together.
+		static constexpr SizeType MaxTaps = internal::power(4, Dimension);  ///< Elements weighted per point, at most.
+		static constexpr SizeType Invalid = ~static_cast<SizeType>(0);      ///< Offset of elements outside the view.
+
+		/**
+		 *    @brief Samples a block of at most Block points.
+		 */
+		inline void sampleBlock(const Point *points, const SizeType count, T *out) const;
+
+		/**
+		 *    @brief Gives the offset along dimension d of index i, according
+		 *           to the border, or Invalid.
+		 */
+		inline SizeType resolve(const SizeType d, std::ptrdiff_t i) const;
+
+		/**
+		 *    @brief Converts an interpolated value to T, rounding to nearest
+		 *           and clamping to the range of T if T is integral.
+		 */
+		static inline T toValue(const Accum &sum, std::true_type);
+		static inline T toValue(const Accum &sum, std::false_type);
+
+		const T                          *_origin;         ///< First element of the view.
+		std::array<SizeType, Dimension>   _size;           ///< Sizes of the view.
+		std::array<SizeType, Dimension>   _stride;         ///< Offsets of the view.
+		Interpolation                     _interpolation;  ///< How to interpolate.
+		Border                            _border;         ///< How to treat the outside.
+		T                                 _borderValue;    ///< Value outside the view.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/Sampler.inl>
+
+#endif // Sampler_hpp
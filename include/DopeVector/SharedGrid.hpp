@@ -0,0 +1,352 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef SharedGrid_hpp
+#define SharedGrid_hpp
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <DopeVector/DopeVector.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The SharedView class is a DopeVector that also holds a reference
+	 *        to the owner of the memory it refers to, which is kept alive as
+	 *        long as the view (or any view derived from it through window(),
+	 *        slice() or permute()) exists. It can be passed wherever a
+	 *        DopeVector is expected, and between threads.
+	 *
+	 *        A SharedView without owner behaves as a plain DopeVector.
+	 * @param T             Type of the data.
+	 * @param Dimension     Dimension of the data.
+	 */
+	template < typename T, SizeType Dimension >
+	class SharedView : public DopeVector<T, Dimension> {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>            IndexD;
+		typedef std::shared_ptr<const void> Owner;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		SharedView() = default;
+
+		/**
+		 *    @brief Initializer constructor.
+		 *    @param view               The view on the memory of owner.
+		 *    @param owner              The owner of the memory, kept alive by
+		 *                              this view.
+		 */
+		inline SharedView(const DopeVector<T, Dimension> &view, Owner owner);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// VIEWS
+		////////////////////////////////////////////////////////////////////////
+
+		using DopeVector<T, Dimension>::permute;
+
+		/**
+		 *    @brief Extracts a window, sharing the owner of this view.
+		 *    @param start              The index of the first element of the
+		 *                              window.
+		 *    @param size               The sizes of the window.
+		 *    @return The output window.
+		 */
+		inline SharedView window(const IndexD &start, const IndexD &size) const;
+
+		/**
+		 *    @brief Extracts a window into a plain view, as DopeVector does.
+		 *    @param start              The index of the first element of the
+		 *                              window.
+		 *    @param size               The sizes of the window.
+		 *    @param w                  The output window.
+		 */
+		inline void window(const IndexD &start, const IndexD &size, DopeVector<T, Dimension> &w) const;
+
+		/**
+		 *    @brief Extracts a 1-dimensional window, sharing the owner of
+		 *           this view.
+		 *    @param start              The first element of the window.
+		 *    @param size               The size of the window.
+		 *    @return The output window.
+		 */
+		template < SizeType D = Dimension >
+		inline typename std::enable_if<(D == 1), SharedView<T, D>>::type window(const SizeType start, const SizeType size) const;
+
+		/**
+		 *    @brief Extracts a 1-dimensional window into a plain view, as
+		 *           DopeVector does.
+		 *    @param start              The first element of the window.
+		 *    @param size               The size of the window.
+		 *    @param w                  The output window.
+		 *    @note The window overloads of DopeVector are not brought in
+		 *          with a using-declaration, which would make overload
+		 *          resolution prefer DopeVector::window(start, size) to the
+		 *          template above.
+		 */
+		template < SizeType D = Dimension >
+		inline typename std::enable_if<(D == 1)>::type window(const SizeType start, const SizeType size, DopeVector<T, D> &w) const;
+
+		/**
+		 *    @brief Permutes the dimensions, sharing the owner of this view.
+		 *    @param order              The new order of the dimensions.
+		 *    @return The output permuted view.
+		 */
+		inline SharedView permute(const IndexD &order) const;
+
+		/**
+		 *    @brief Extracts a slice, sharing the owner of this view.
+		 *    @param d                  The dimension to cut.
+		 *    @param i                  The index of the slice along d.
+		 *    @return The output slice.
+		 */
+		template < SizeType D = Dimension >
+		inline typename std::enable_if<(D > 1), SharedView<T, D-1>>::type slice(const SizeType d, const SizeType i) const;
+
+		/**
+		 *    @brief Extracts a slice into a plain view, as DopeVector does.
+		 *    @param d                  The dimension to cut.
+		 *    @param i                  The index of the slice along d.
+		 *    @param s                  The output slice.
+		 *    @note A using-declaration would also bring the two-argument
+		 *          DopeVector::slice, which overload resolution would prefer
+		 *          to the template above.
+		 */
+		template < SizeType D = Dimension >
+		inline typename std::enable_if<(D > 1)>::type slice(const SizeType d, const SizeType i, DopeVector<T, D-1> &s) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief The owner kept alive by this view, if any.
+		 */
+		inline const Owner & owner() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		Owner _owner;       ///< Owner of the memory.
+	};
+
+
+
+	/**
+	 * @brief The SharedGrid class describes a D-dimensional grid like Grid,
+	 *        but its elements are stored in a reference-counted buffer.
+	 *        Views taken with view() share the ownership of the buffer, so
+	 *        they stay valid after the grid is resized, cleared or destroyed:
+	 *        these operations give the grid a new buffer instead of changing
+	 *        the old one in place.
+	 *
+	 *        Copying a SharedGrid copies its elements, as copying a Grid does.
+	 *        Plain DopeVector views (e.g. from the inherited window()) do not
+	 *        keep the buffer alive.
+	 * @param T             Type of the data to be stored.
+	 * @param Dimension     Dimension of the grid.
+	 * @param Allocator     Allocator to be used to store the data.
+	 */
+	template < typename T, SizeType Dimension, class Allocator = std::allocator< T > >
+	class SharedGrid : public DopeVector<T, Dimension> {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>          IndexD;
+		typedef std::vector<T, Allocator> Data;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		SharedGrid() = default;
+
+		/**
+		 *    @brief Initializer contructor.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 */
+		inline explicit SharedGrid(const IndexD &size, const T &default_value = T());
+
+		/**
+		 *    @brief Initializer contructor.
+		 *    @param size               Size of the D-dimensional grid in each
+		 *                              dimension.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 */
+		inline explicit SharedGrid(const SizeType size, const T &default_value = T());
+
+		/**
+		 *    @brief Conversion contructor.
+		 *    @param o                  The matrix (e.g. a Grid) to copy
+		 *                              sizes and elements from.
+		 */
+		inline explicit SharedGrid(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copy constructor: copies the elements of o in a new
+		 *           buffer.
+		 */
+		inline SharedGrid(const SharedGrid &o);
+
+		/**
+		 *    @brief Move constructor. o is left empty.
+		 */
+		inline SharedGrid(SharedGrid &&o);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DATA
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Give access to the first element of the grid.
+		 *    @return The const pointer to the first element of the grid.
+		 */
+		inline const T * data() const;
+
+		/**
+		 *    @brief Give access to the first element of the grid.
+		 *    @return The pointer to the first element of the grid.
+		 */
+		inline T * data();
+
+		/**
+		 *    @brief Gives the buffer of the grid, which can be kept to extend
+		 *           its lifetime.
+		 */
+		inline const std::shared_ptr<Data> & buffer() const;
+
+		/**
+		 *    @brief Gives a view of the whole grid that keeps its current
+		 *           buffer alive.
+		 */
+		inline SharedView<T, Dimension> view() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Check the number of elements in the grid.
+		 *    @return true if the grid has no elements. false otherwise.
+		 */
+		inline bool empty() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RESET
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Release the buffer of the grid, setting it empty. Views
+		 *           sharing the buffer are not affected.
+		 */
+		inline void clear();
+
+		/**
+		 *    @brief Resize the container, in a new buffer. Views sharing the
+		 *           old buffer are not affected.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 *    @note Data is not kept.
+		 */
+		inline void resize(const IndexD &size, const T &default_value = T());
+
+		/**
+		 *    @brief Resize the container, in a new buffer. Views sharing the
+		 *           old buffer are not affected.
+		 *    @param size               Size of the D-dimensional grid in each
+		 *                              dimension.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 *    @note Data is not kept.
+		 */
+		inline void resize(const SizeType size, const T &default_value = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ASSIGNMENTS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Copy assignment operator: copies the elements of o in a
+		 *           new buffer.
+		 */
+		inline SharedGrid & operator=(const SharedGrid &o);
+
+		/**
+		 *    @brief Move assignment operator. o is left empty.
+		 */
+		inline SharedGrid & operator=(SharedGrid &&o);
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		// hyde some methods from DopeVector
+		using DopeVector<T, Dimension>::reset;
+
+		std::shared_ptr<Data> _data;        ///< Elements of the grid.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/SharedGrid.inl>
+
+#endif // SharedGrid_hpp
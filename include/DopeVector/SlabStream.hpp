@@ -0,0 +1,284 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef SlabStream_hpp
+#define SlabStream_hpp
+
+#include <istream>
+#include <ostream>
+#include <vector>
+#include <DopeVector/DopeVector.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The SlabReader class streams a D-dimensional dataset, stored as
+	 *        raw row-major elements in a std::istream, as a sequence of slabs
+	 *        along the first dimension. Each slab is presented as a
+	 *        DopeVector over one of a bounded ring of buffers, so memory use
+	 *        depends on the given budget and not on the dataset size.
+	 *        Consecutive slabs may overlap by a halo of rows, which allows
+	 *        stencils to work across slab boundaries.
+	 * @param T             Type of the data to be read.
+	 * @param Dimension     Dimension of the dataset.
+	 */
+	template < typename T, SizeType Dimension >
+	class SlabReader {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension> IndexD;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Initializer constructor.
+		 *    @param stream             The stream to read the dataset from. It
+		 *                              is read sequentially, never seeked.
+		 *    @param size               Sizes of the whole D-dimensional
+		 *                              dataset.
+		 *    @param memoryBudget       Maximum number of bytes used by the
+		 *                              ring of slab buffers.
+		 *    @param halo               Number of rows along the first
+		 *                              dimension shared with the previous and
+		 *                              the next slab.
+		 *    @param ringSize           Number of slab buffers in the ring. A
+		 *                              slab returned by next() stays valid for
+		 *                              the following ringSize-1 calls.
+		 *    @throw std::invalid_argument if the budget can not hold at least
+		 *                              one row plus the halos per buffer.
+		 */
+		inline SlabReader(std::istream &stream, const IndexD &size, const SizeType memoryBudget, const SizeType halo = 0, const SizeType ringSize = 2);
+
+		SlabReader(const SlabReader &) = delete;
+
+		SlabReader & operator=(const SlabReader &) = delete;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// STREAMING
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Reads the next slab.
+		 *    @param slab               The output slab, including the halo
+		 *                              rows available around its core.
+		 *    @return false if the whole dataset has already been read, true
+		 *            otherwise.
+		 *    @throw std::runtime_error if the stream ends prematurely.
+		 */
+		inline bool next(DopeVector<T, Dimension> &slab);
+
+		/**
+		 *    @brief Gives access to the core of the last slab read, i.e.
+		 *           without halo rows.
+		 *    @return The window of the current slab owned by no other slab.
+		 */
+		inline DopeVector<T, Dimension> core() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the whole dataset.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Number of core rows per slab, derived from the budget.
+		 */
+		inline SizeType slabThickness() const;
+
+		/**
+		 *    @brief Total number of slabs the dataset is split into.
+		 */
+		inline SizeType slabCount() const;
+
+		/**
+		 *    @brief Row of the dataset where the last slab read (halo
+		 *           included) starts.
+		 */
+		inline SizeType slabStart() const;
+
+		/**
+		 *    @brief Number of halo rows preceding the core of the last slab
+		 *           read.
+		 */
+		inline SizeType haloBefore() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		std::istream                 &_stream;      ///< Stream the dataset is read from.
+		IndexD                        _size;        ///< Sizes of the whole dataset.
+		SizeType                      _rowSize;     ///< Number of elements in a row along the first dimension.
+		SizeType                      _halo;        ///< Rows shared by consecutive slabs.
+		SizeType                      _thickness;   ///< Core rows per slab.
+		std::vector<std::vector<T>>   _ring;        ///< Slab buffers.
+		SizeType                      _next;        ///< Index of the next slab to read.
+		SizeType                      _rowsRead;    ///< Rows already read from the stream.
+		SizeType                      _viewStart;   ///< First row of the current slab.
+		SizeType                      _viewEnd;     ///< One past the last row of the current slab.
+		SizeType                      _coreStart;   ///< First core row of the current slab.
+		SizeType                      _coreEnd;     ///< One past the last core row of the current slab.
+		DopeVector<T, Dimension>      _current;     ///< The current slab.
+	};
+
+
+
+	/**
+	 * @brief The SlabWriter class streams a D-dimensional dataset to a
+	 *        std::ostream as raw row-major elements, one slab along the first
+	 *        dimension at a time. Slabs are handed out as DopeVector's over a
+	 *        bounded ring of buffers and are written when their buffer gets
+	 *        recycled or on flush().
+	 * @param T             Type of the data to be written.
+	 * @param Dimension     Dimension of the dataset.
+	 */
+	template < typename T, SizeType Dimension >
+	class SlabWriter {
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension> IndexD;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Initializer constructor.
+		 *    @param stream             The stream to write the dataset to.
+		 *    @param size               Sizes of the whole D-dimensional
+		 *                              dataset.
+		 *    @param memoryBudget       Maximum number of bytes used by the
+		 *                              ring of slab buffers.
+		 *    @param ringSize           Number of slab buffers in the ring. A
+		 *                              slab returned by next() can be written
+		 *                              to during the following ringSize-1
+		 *                              calls.
+		 *    @throw std::invalid_argument if the budget can not hold at least
+		 *                              one row per buffer.
+		 */
+		inline SlabWriter(std::ostream &stream, const IndexD &size, const SizeType memoryBudget, const SizeType ringSize = 2);
+
+		SlabWriter(const SlabWriter &) = delete;
+
+		SlabWriter & operator=(const SlabWriter &) = delete;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DESTRUCTOR
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Destructor. Pending slabs are written out, but errors
+		 *           are only reported through the stream state. Call flush()
+		 *           to get them as exceptions.
+		 */
+		inline ~SlabWriter();
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// STREAMING
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives the next slab to be filled.
+		 *    @param slab               The output slab.
+		 *    @return false if the whole dataset has already been handed out,
+		 *            true otherwise.
+		 *    @throw std::runtime_error if writing a recycled slab fails.
+		 */
+		inline bool next(DopeVector<T, Dimension> &slab);
+
+		/**
+		 *    @brief Writes all the pending slabs to the stream.
+		 *    @throw std::runtime_error if writing fails.
+		 */
+		inline void flush();
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the whole dataset.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Number of rows per slab, derived from the budget.
+		 */
+		inline SizeType slabThickness() const;
+
+		/**
+		 *    @brief Total number of slabs the dataset is split into.
+		 */
+		inline SizeType slabCount() const;
+
+		/**
+		 *    @brief Row of the dataset where the last slab handed out starts.
+		 */
+		inline SizeType slabStart() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		inline bool writePending(const SizeType upTo);
+
+		std::ostream                 &_stream;      ///< Stream the dataset is written to.
+		IndexD                        _size;        ///< Sizes of the whole dataset.
+		SizeType                      _rowSize;     ///< Number of elements in a row along the first dimension.
+		SizeType                      _thickness;   ///< Rows per slab.
+		std::vector<std::vector<T>>   _ring;        ///< Slab buffers.
+		SizeType                      _next;        ///< Index of the next slab to hand out.
+		SizeType                      _written;     ///< Number of slabs already written.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/SlabStream.inl>
+
+#endif // SlabStream_hpp
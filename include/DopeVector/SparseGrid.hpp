@@ -0,0 +1,271 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef SparseGrid_hpp
+#define SparseGrid_hpp
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <DopeVector/DopeVector.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The SparseGrid class describes a D-dimensional grid that only
+	 *        stores the blocks of BlockSize^D elements which have been written
+	 *        to. Reading an element of a block never written gives a
+	 *        background value. Allocated (active) blocks are dense and can be
+	 *        accessed as DopeVector's, which stay valid until the grid is
+	 *        cleared or destroyed.
+	 * @param T             Type of the data to be stored.
+	 * @param Dimension     Dimension of the grid.
+	 * @param BlockSize     Side length of a block.
+	 */
+	template < typename T, SizeType Dimension, SizeType BlockSize = 8 >
+	class SparseGrid {
+		static_assert(BlockSize > static_cast<SizeType>(0), "Blocks can not be empty.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension> IndexD;
+
+		static constexpr SizeType BlockVolume = internal::power(BlockSize, Dimension); ///< Number of elements in a block.
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		inline SparseGrid();
+
+		/**
+		 *    @brief Initializer contructor.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param background         Value of the elements never written.
+		 */
+		inline explicit SparseGrid(const IndexD &size, const T &background = T());
+
+		/**
+		 *    @brief Conversion contructor. Only the blocks of o containing
+		 *           elements different from background are allocated.
+		 *    @param o                  The matrix (e.g. a Grid) to copy
+		 *                              sizes and elements from.
+		 *    @param background         Value of the elements never written.
+		 */
+		inline explicit SparseGrid(const DopeVector<T, Dimension> &o, const T &background = T());
+
+		SparseGrid(const SparseGrid &) = delete;
+
+		/**
+		 *    @brief Move constructor.
+		 */
+		SparseGrid(SparseGrid &&) = default;
+
+		SparseGrid & operator=(const SparseGrid &) = delete;
+
+		/**
+		 *    @brief Move assignment operator.
+		 */
+		SparseGrid & operator=(SparseGrid &&) = default;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ACCESS METHODS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives access to the element at index i, without
+		 *           allocating anything.
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i, or the background value if its
+		 *            block is not active.
+		 */
+		inline const T & at(const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i for writing,
+		 *           activating its block if needed.
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & at(const IndexD &i);
+
+		/**
+		 *    @brief Gives access to the element at index i, without
+		 *           allocating anything.
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i, or the background value if its
+		 *            block is not active.
+		 */
+		inline const T & operator[](const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i for writing,
+		 *           activating its block if needed.
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & operator[](const IndexD &i);
+
+		/**
+		 *    @brief Checks if the block containing an element is active.
+		 *    @param i                  The index of the element.
+		 */
+		inline bool isActive(const IndexD &i) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BLOCKS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Number of blocks allocated so far.
+		 */
+		inline SizeType activeBlockCount() const;
+
+		/**
+		 *    @brief Gives access to the k-th active block, in activation
+		 *           order.
+		 *    @param k                  The number of the active block.
+		 *    @return A dense view of the elements of the block. Blocks on the
+		 *            upper border are cut to the sizes of the grid.
+		 */
+		inline DopeVector<T, Dimension> activeBlock(const SizeType k) const;
+
+		/**
+		 *    @brief Index in the grid of the first element of the k-th active
+		 *           block.
+		 *    @param k                  The number of the active block.
+		 */
+		inline IndexD activeBlockOrigin(const SizeType k) const;
+
+		/**
+		 *    @brief Gives access to the block at a given block index,
+		 *           activating it if needed.
+		 *    @param b                  The index of the block, i.e. the index
+		 *                              of any of its elements divided by
+		 *                              BlockSize.
+		 *    @return A dense view of the elements of the block. Blocks on the
+		 *            upper border are cut to the sizes of the grid.
+		 */
+		inline DopeVector<T, Dimension> block(const IndexD &b);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERSIONS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Copies all single elements from o to this grid. Blocks
+		 *           of o only containing background values are not
+		 *           activated, and active ones are not deactivated.
+		 *    @param o                  The matrix to copy from.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void import(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copies all single elements of this grid into o, including
+		 *           background ones.
+		 *    @param o                  The matrix to copy to.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void exportTo(DopeVector<T, Dimension> &o) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the grid, for each dimension.
+		 */
+		inline const IndexD & allSizes() const;
+
+		/**
+		 *    @brief Size of the grid in a given dimension.
+		 */
+		inline SizeType sizeAt(const SizeType d) const;
+
+		/**
+		 *    @brief Number of elements of the grid, active or not.
+		 */
+		inline SizeType size() const;
+
+		/**
+		 *    @brief Value of the elements never written.
+		 */
+		inline const T & background() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RESET
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Deactivates all the blocks, so that all the elements are
+		 *           background again.
+		 */
+		inline void clear();
+
+		/**
+		 *    @brief Resize the container, deactivating all the blocks.
+		 *    @param size               Sizes of the D-dimensional grid.
+		 *    @param background         Value of the elements never written.
+		 */
+		inline void resize(const IndexD &size, const T &background = T());
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		typedef internal::Bounds<BoundsCheckPolicy<T, Dimension>::value> Check;
+
+		inline SizeType blockPosition(const IndexD &i, SizeType &local) const;
+		inline SizeType activate(const SizeType b);
+		inline DopeVector<T, Dimension> blockView(const SizeType slot) const;
+
+		IndexD                                  _size;          ///< Sizes of the grid.
+		IndexD                                  _blocks;        ///< Number of blocks in each dimension.
+		T                                       _background;    ///< Value of the elements never written.
+		std::unordered_map<SizeType, SizeType>  _table;         ///< Linear block index to slot in _storage.
+		std::vector<std::unique_ptr<T[]>>       _storage;       ///< Elements of the active blocks.
+		std::vector<SizeType>                   _keys;          ///< Linear block index of each slot.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/SparseGrid.inl>
+
+#endif // SparseGrid_hpp
@@ -0,0 +1,323 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef StaticGrid_hpp
+#define StaticGrid_hpp
+
+#include <array>
+#include <DopeVector/DopeVector.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		/**
+		 * @brief The StaticExtents class computes at compile time sizes,
+		 *        row-major strides and linear positions of a grid whose sizes
+		 *        are known at compile time.
+		 * @param Sizes         Sizes of the grid, for each dimension.
+		 */
+		template < SizeType ... Sizes >
+		struct StaticExtents;
+
+		template < >
+		struct StaticExtents< > {
+			static constexpr SizeType Dimension = 0;
+			static constexpr SizeType Volume = 1;
+
+			static constexpr SizeType sizeAt(const SizeType)   { return 0; }
+			static constexpr SizeType strideAt(const SizeType) { return 0; }
+			static constexpr SizeType position()               { return 0; }
+		};
+
+		template < SizeType Size, SizeType ... Sizes >
+		struct StaticExtents< Size, Sizes... > {
+			static constexpr SizeType Dimension = 1 + sizeof...(Sizes);
+			static constexpr SizeType Volume = Size * StaticExtents<Sizes...>::Volume;
+			static constexpr SizeType Stride = StaticExtents<Sizes...>::Volume;
+
+			static constexpr SizeType sizeAt(const SizeType d)
+			{
+				return d == static_cast<SizeType>(0) ? Size : StaticExtents<Sizes...>::sizeAt(d - 1);
+			}
+
+			static constexpr SizeType strideAt(const SizeType d)
+			{
+				return d == static_cast<SizeType>(0) ? Stride : StaticExtents<Sizes...>::strideAt(d - 1);
+			}
+
+			template < typename ... Args >
+			static constexpr SizeType position(const SizeType i, const Args ... is)
+			{
+				return i * Stride + StaticExtents<Sizes...>::position(is...);
+			}
+		};
+
+	}
+
+	/**
+	 * @brief The StaticGrid class describes a D-dimensional grid whose sizes
+	 *        are template parameters. Elements are stored in place, in
+	 *        row-major order, so that index arithmetic is made of compile
+	 *        time constants and loops over the grid can be fully unrolled and
+	 *        vectorized. It converts to a DopeVector to be passed to generic
+	 *        code.
+	 * @param T             Type of the data to be stored.
+	 * @param Sizes         Sizes of the grid, for each dimension.
+	 */
+	template < typename T, SizeType ... Sizes >
+	class StaticGrid {
+		static_assert(sizeof...(Sizes) > 0, "StaticGrid must have at least one dimension.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef internal::StaticExtents<Sizes...> Extents;
+
+		static constexpr SizeType Dimension = Extents::Dimension;  ///< Dimension of the grid.
+		static constexpr SizeType Volume = Extents::Volume;        ///< Number of elements of the grid.
+
+		typedef Index<Dimension>          IndexD;
+		typedef std::array<T, Volume>     Data;
+		typedef T *                       iterator;
+		typedef const T *                 const_iterator;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor. Elements are value-initialized.
+		 */
+		inline StaticGrid();
+
+		/**
+		 *    @brief Initializer contructor.
+		 *    @param default_value      Default value assigned to the grid
+		 *                              elements.
+		 */
+		inline explicit StaticGrid(const T &default_value);
+
+		/**
+		 *    @brief Conversion contructor.
+		 *    @param o                  The matrix to copy elements from.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline explicit StaticGrid(const DopeVector<T, Dimension> &o);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ACCESS METHODS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives access to the element at index (i_0, ..., i_D-1),
+		 *           computing its position from compile time strides. The
+		 *           components are checked against the compile time sizes
+		 *           as BoundsCheckPolicy says.
+		 *    @param is                 The index components, one per
+		 *                              dimension.
+		 *    @return The element at the given index.
+		 */
+		template < typename ... Args >
+		inline const T & operator()(const Args ... is) const;
+
+		/**
+		 *    @brief Gives access to the element at index (i_0, ..., i_D-1),
+		 *           computing its position from compile time strides. The
+		 *           components are checked against the compile time sizes
+		 *           as BoundsCheckPolicy says.
+		 *    @param is                 The index components, one per
+		 *                              dimension.
+		 *    @return The element at the given index.
+		 */
+		template < typename ... Args >
+		inline T & operator()(const Args ... is);
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & at(const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & at(const IndexD &i);
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline const T & operator[](const IndexD &i) const;
+
+		/**
+		 *    @brief Gives access to the element at index i
+		 *    @param i                  The index of the element.
+		 *    @return The element at index i.
+		 */
+		inline T & operator[](const IndexD &i);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// ITERATORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Pointer to the first element, in row-major order.
+		 */
+		inline iterator begin();
+
+		/**
+		 *    @brief Pointer past the last element, in row-major order.
+		 */
+		inline iterator end();
+
+		/**
+		 *    @brief Pointer to the first element, in row-major order.
+		 */
+		inline const_iterator begin() const;
+
+		/**
+		 *    @brief Pointer past the last element, in row-major order.
+		 */
+		inline const_iterator end() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONVERSIONS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Gives a DopeVector viewing the elements of this grid.
+		 */
+		inline DopeVector<T, Dimension> view();
+
+		/**
+		 *    @brief Gives a DopeVector viewing the elements of this grid.
+		 */
+		inline const DopeVector<T, Dimension> view() const;
+
+		/**
+		 *    @brief Implicit conversion to a DopeVector viewing the elements
+		 *           of this grid.
+		 */
+		inline operator DopeVector<T, Dimension>();
+
+		/**
+		 *    @brief Implicit conversion to a DopeVector viewing the elements
+		 *           of this grid.
+		 */
+		inline operator const DopeVector<T, Dimension>() const;
+
+		/**
+		 *    @brief Copies all single elements from o to this grid.
+		 *    @param o                  The matrix to copy from.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void import(const DopeVector<T, Dimension> &o);
+
+		/**
+		 *    @brief Copies all single elements of this grid into o.
+		 *    @param o                  The matrix to copy to.
+		 *    @throw std::out_of_range if sizes do not match.
+		 */
+		inline void exportTo(DopeVector<T, Dimension> &o) const;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// INFORMATION
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sizes of the grid, for each dimension.
+		 */
+		static inline IndexD allSizes();
+
+		/**
+		 *    @brief Size of the grid in a given dimension.
+		 */
+		static constexpr SizeType sizeAt(const SizeType d);
+
+		/**
+		 *    @brief Offsets of the grid, for each dimension.
+		 */
+		static inline IndexD allOffsets();
+
+		/**
+		 *    @brief Offset of the grid in a given dimension.
+		 */
+		static constexpr SizeType offsetAt(const SizeType d);
+
+		/**
+		 *    @brief Number of elements of the grid.
+		 */
+		static constexpr SizeType size();
+
+		/**
+		 *    @brief Give access to the first element of the grid.
+		 */
+		inline const T * data() const;
+
+		/**
+		 *    @brief Give access to the first element of the grid.
+		 */
+		inline T * data();
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// RESET
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Assigns a value to all the elements of the grid.
+		 */
+		inline void fill(const T &value);
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		typedef internal::Bounds<BoundsCheckPolicy<T, Dimension>::value> Check;
+
+		static inline SizeType position(const IndexD &i);
+
+		Data    _data;  ///< Elements of the grid.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/StaticGrid.inl>
+
+#endif // StaticGrid_hpp
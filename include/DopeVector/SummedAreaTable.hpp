@@ -0,0 +1,120 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef SummedAreaTable_hpp
+#define SummedAreaTable_hpp
+
+#include <DopeVector/Grid.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The SummedAreaTable class describes the D-dimensional inclusive
+	 *        prefix sum (integral image) of a view: element i of the table is
+	 *        the sum of the elements of the view with all indices not greater
+	 *        than those of i. The sum of any window is then given by 2^D
+	 *        elements of the table.
+	 *
+	 *        The table is built in one pass per dimension: the pass along the
+	 *        last dimension scans each line of the view, the others add whole
+	 *        contiguous rows of the table, in loops the compiler can
+	 *        vectorize. Lines and rows are split across threads.
+	 * @param T             Type of the data.
+	 * @param Dimension     Dimension of the data.
+	 * @param Accum         Type of the sums, e.g. a wider type than T to avoid
+	 *                      overflows. With unsigned integers, window sums are
+	 *                      correct as long as they fit Accum, even if the
+	 *                      table wraps.
+	 * @param Allocator     Allocator to be used to store the table.
+	 */
+	template < typename T, SizeType Dimension, typename Accum = T, class Allocator = std::allocator< Accum > >
+	class SummedAreaTable {
+		static_assert(Dimension > static_cast<SizeType>(1), "Summed-area tables need at least two dimensions.");
+	public:
+
+		////////////////////////////////////////////////////////////////////////
+		// TYPEDEFS
+		////////////////////////////////////////////////////////////////////////
+
+		typedef Index<Dimension>                    IndexD;
+		typedef Grid<Accum, Dimension, Allocator>   Table;
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Default constructor.
+		 */
+		SummedAreaTable() = default;
+
+		/**
+		 *    @brief Initializer constructor: builds the table of a view.
+		 *    @param view               The view to sum.
+		 */
+		inline explicit SummedAreaTable(const DopeVector<T, Dimension> &view);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// BUILD
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Builds the table of a view, replacing the current one.
+		 *    @param view               The view to sum.
+		 */
+		inline void build(const DopeVector<T, Dimension> &view);
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// QUERIES
+		////////////////////////////////////////////////////////////////////////
+
+		/**
+		 *    @brief Sums the elements of a window of the view.
+		 *    @param start              Index of the first element of the
+		 *                              window.
+		 *    @param size               Sizes of the window.
+		 *    @return The sum, 0 for an empty window.
+		 *    @throw std::out_of_range if the window exceeds the view.
+		 */
+		inline Accum regionSum(const IndexD &start, const IndexD &size) const;
+
+		/**
+		 *    @brief Gives access to the table.
+		 */
+		inline const Table & table() const;
+
+		/**
+		 *    @brief Sizes of the table, equal to those of the view.
+		 */
+		inline const IndexD & allSizes() const;
+
+		////////////////////////////////////////////////////////////////////////
+
+	private:
+		Table _table;       ///< The prefix sums.
+	};
+
+}
+
+#include <DopeVector/internal/inlines/SummedAreaTable.inl>
+
+#endif // SummedAreaTable_hpp
@@ -0,0 +1,187 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Tracing_hpp
+#define Tracing_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <DopeVector/internal/Common.hpp>
+
+/**
+ * Number of spans each thread can record before further ones are dropped.
+ */
+#ifndef DOPE_TRACE_BUFFER_SIZE
+	#define DOPE_TRACE_BUFFER_SIZE 65536
+#endif
+
+/**
+ * Maximum number of buffers, i.e. of threads recording at the same time; the
+ * spans of further threads are dropped.
+ */
+#ifndef DOPE_TRACE_MAX_BUFFERS
+	#define DOPE_TRACE_MAX_BUFFERS 64
+#endif
+
+namespace dope {
+
+	/**
+	 * @brief The Tracing class exports the spans recorded around the heavy
+	 *        operations of the library (imports, copies, resizes, slab I/O
+	 *        and parallel kernels) as a Chrome trace, to be opened in
+	 *        chrome://tracing or https://ui.perfetto.dev.
+	 *
+	 *        Spans are only recorded when DOPE_USE_TRACING is defined (with
+	 *        cmake, -DWITH_TRACING=ON); otherwise DOPE_TRACE_SCOPE expands to
+	 *        nothing. Each thread appends to its own buffer without locks; a
+	 *        span nested in a span of the same name (e.g. the recursive
+	 *        imports of the rows of a matrix) is merged into the outer one.
+	 *        When a thread exits its buffer, with the spans it holds, is
+	 *        handed to the next thread that starts recording, so threads
+	 *        that never run at the same time share a track.
+	 */
+	class Tracing {
+	public:
+		/**
+		 *    @brief Tells whether spans are recorded in this build.
+		 */
+		static constexpr bool enabled();
+
+		/**
+		 *    @brief Writes the spans completed so far by all threads in the
+		 *           Chrome trace event format.
+		 *    @param out                The stream to write to.
+		 */
+		static inline void writeChromeTrace(std::ostream &out);
+
+		/**
+		 *    @brief Writes the spans completed so far by all threads in the
+		 *           Chrome trace event format.
+		 *    @param path               The file to write to.
+		 *    @return true on success.
+		 */
+		static inline bool writeChromeTrace(const std::string &path);
+
+		/**
+		 *    @brief Discards the recorded spans.
+		 *    @note No thread should be recording while clearing.
+		 */
+		static inline void clear();
+
+		/**
+		 *    @brief Gives the number of spans dropped because the buffer of
+		 *           their thread was full, or because no buffer was left for
+		 *           their thread.
+		 */
+		static inline SizeType dropped();
+	};
+
+	namespace internal {
+
+		/**
+		 * @brief A completed span. The name must be a string with static
+		 *        storage duration, e.g. a literal.
+		 */
+		struct TraceEvent {
+			const char     *name;
+			std::int64_t    start;      ///< Nanoseconds since the epoch of std::chrono::steady_clock.
+			std::int64_t    duration;   ///< Nanoseconds.
+		};
+
+		/**
+		 * @brief The TraceBuffer class holds the spans of a thread. Only the
+		 *        owning thread appends, publishing every event through an
+		 *        atomic count, so that exporters can read concurrently.
+		 */
+		class TraceBuffer {
+		public:
+			inline explicit TraceBuffer(const SizeType thread);
+
+			inline void append(const TraceEvent &event);
+
+			std::unique_ptr<TraceEvent[]>   events;
+			std::atomic<SizeType>           count;
+			std::atomic<SizeType>           dropped;
+			const SizeType                  thread;     ///< Sequential id of the owning thread.
+			const char                     *open;       ///< Name of the innermost open span.
+		};
+
+		/**
+		 * @brief The buffers of all the threads that recorded a span, and
+		 *        those released by the threads that exited.
+		 */
+		struct TraceRegistry {
+			std::mutex                                  mutex;
+			std::vector<std::shared_ptr<TraceBuffer>>   buffers;
+			std::vector<TraceBuffer *>                  released;
+			std::atomic<SizeType>                       dropped;    ///< Spans of threads without a buffer.
+		};
+
+		inline TraceRegistry & traceRegistry();
+
+		/**
+		 * @brief The TraceLease class holds the buffer of a thread and
+		 *        releases it to the registry when the thread exits.
+		 */
+		class TraceLease {
+		public:
+			inline TraceLease();
+			inline ~TraceLease();
+
+			TraceLease(const TraceLease &) = delete;
+			TraceLease & operator=(const TraceLease &) = delete;
+
+			TraceBuffer    *buffer;     ///< Null if no buffer was left.
+		};
+
+		/**
+		 * @brief Gives the buffer of the calling thread, taking a released
+		 *        one or registering a new one on first use.
+		 * @return Null if DOPE_TRACE_MAX_BUFFERS buffers are in use.
+		 */
+		inline TraceBuffer * traceBuffer();
+
+		/**
+		 * @brief The TraceScope class records a span from its construction to
+		 *        its destruction.
+		 */
+		class TraceScope {
+		public:
+			inline explicit TraceScope(const char *name);
+			inline ~TraceScope();
+
+			TraceScope(const TraceScope &) = delete;
+			TraceScope & operator=(const TraceScope &) = delete;
+
+		private:
+			TraceBuffer    *_buffer;    ///< Null if merged into an outer span or dropped.
+			const char     *_name;
+			const char     *_outer;     ///< Name of the enclosing span.
+			std::int64_t    _start;
+		};
+
+	}
+
+}
+
+#ifdef DOPE_USE_TRACING
+	#define DOPE_TRACE_SCOPE(name) ::dope::internal::TraceScope dope_trace_scope_(name)
+#else
+	#define DOPE_TRACE_SCOPE(name)
+#endif
+
+#include <DopeVector/internal/inlines/Tracing.inl>
+
+#endif // Tracing_hpp
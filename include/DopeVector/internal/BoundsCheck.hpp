@@ -0,0 +1,104 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef BoundsCheck_hpp
+#define BoundsCheck_hpp
+
+#include <DopeVector/internal/Common.hpp>
+
+/**
+ * Values of DOPE_BOUNDS_CHECK, selecting how accessors check their indexes:
+ * DOPE_BOUNDS_CHECKED throws std::out_of_range (default), DOPE_BOUNDS_ASSERTED
+ * uses assert(), so checks disappear when NDEBUG is defined, and
+ * DOPE_BOUNDS_UNCHECKED never checks.
+ */
+#define DOPE_BOUNDS_CHECKED   0
+#define DOPE_BOUNDS_ASSERTED  1
+#define DOPE_BOUNDS_UNCHECKED 2
+
+#ifndef DOPE_BOUNDS_CHECK
+	#define DOPE_BOUNDS_CHECK DOPE_BOUNDS_CHECKED
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define DOPE_COLD __attribute__((cold))
+#elif defined(_MSC_VER)
+	#define DOPE_COLD __declspec(noinline)
+#else
+	#define DOPE_COLD
+#endif
+
+namespace dope {
+
+	/**
+	 * @brief The BoundsCheck enumeration lists the ways accessors may check
+	 *        their indexes.
+	 */
+	enum class BoundsCheck {
+		Checked   = DOPE_BOUNDS_CHECKED,    ///< Throw std::out_of_range.
+		Asserted  = DOPE_BOUNDS_ASSERTED,   ///< assert(), only in debug builds.
+		Unchecked = DOPE_BOUNDS_UNCHECKED   ///< No check at all.
+	};
+
+	/**
+	 * @brief The BoundsCheckPolicy trait gives the way DopeVector<T, Dimension>
+	 *        (and so Grid<T, Dimension>) checks indexes in at(), operator[],
+	 *        window(), slice() and iterators, and the other containers in
+	 *        at() (and StaticGrid in operator()). It defaults to the value of
+	 *        DOPE_BOUNDS_CHECK and can be specialized for a given type, e.g.:
+	 *
+	 *        template < > struct BoundsCheckPolicy<float, 3> {
+	 *            static constexpr BoundsCheck value = BoundsCheck::Unchecked;
+	 *        };
+	 */
+	template < typename T, SizeType Dimension >
+	struct BoundsCheckPolicy {
+		static constexpr BoundsCheck value = static_cast<BoundsCheck>(DOPE_BOUNDS_CHECK);
+	};
+
+	namespace internal {
+
+		/**
+		 * @brief Error paths of the checks, marked cold so that the compiler
+		 *        moves them away from the inlined accessors.
+		 */
+		[[noreturn]] DOPE_COLD inline void throw_index_out_of_range(const SizeType i, const SizeType size);
+		[[noreturn]] DOPE_COLD inline void throw_window_out_of_range(const SizeType start, const SizeType size, const SizeType available);
+		[[noreturn]] DOPE_COLD inline void throw_invalid_iterator();
+
+		/**
+		 * @brief The Bounds class performs the checks according to a policy.
+		 */
+		template < BoundsCheck Policy >
+		struct Bounds {
+			/**
+			 * @brief Checks that 0 <= i < size.
+			 */
+			static inline void index(const SizeType i, const SizeType size);
+
+			/**
+			 * @brief Checks that a window of a given size starting at start
+			 *        fits in available elements.
+			 */
+			static inline void window(const SizeType start, const SizeType size, const SizeType available);
+
+			/**
+			 * @brief Checks that an iterator can be dereferenced.
+			 */
+			static inline void iterator(const bool valid);
+		};
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/BoundsCheck.inl>
+
+#endif // BoundsCheck_hpp
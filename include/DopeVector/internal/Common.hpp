@@ -12,6 +12,8 @@
 #define Common_hpp
 
 #include <cstdlib>
+#include <functional>
+#include <type_traits>
 
 #ifndef _SIZETYPE_
 	#define DOPE_SIZETYPE std::size_t
@@ -26,6 +28,28 @@ namespace dope {
 	 */
 	using SizeType = std::make_unsigned<DOPE_SIZETYPE>::type;
 
+	namespace internal {
+
+		/**
+		 * @brief Computes base^exponent at compile time.
+		 */
+		constexpr SizeType power(const SizeType base, const SizeType exponent)
+		{
+			return exponent == static_cast<SizeType>(0) ? static_cast<SizeType>(1) : base * power(base, exponent - 1);
+		}
+
+		/**
+		 * @brief Tells whether the ranges [a, a+n) and [b, b+n) share memory.
+		 */
+		template < typename T >
+		inline bool overlap(const T *a, const T *b, const SizeType n)
+		{
+			std::less<const T *> less;
+			return less(a, b + n) && less(b, a + n);
+		}
+
+	}
+
 }
 
 #endif // Common_hpp
@@ -0,0 +1,89 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Divider_hpp
+#define Divider_hpp
+
+#include <DopeVector/internal/Common.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		/**
+		 * @brief The Divider class divides by a constant with a multiplication
+		 *        and two shifts, using a multiplicative inverse computed once
+		 *        (Granlund and Montgomery, "Division by invariant integers
+		 *        using multiplication"). It is exact for all dividends and
+		 *        non-zero divisors.
+		 */
+		class Divider {
+		public:
+
+			////////////////////////////////////////////////////////////////////
+			// CONSTRUCTORS
+			////////////////////////////////////////////////////////////////////
+
+			/**
+			 *    @brief Default constructor: divides by 1.
+			 */
+			inline Divider();
+
+			/**
+			 *    @brief Initializer constructor.
+			 *    @param divisor            The divisor.
+			 *    @throw std::overflow_error if divisor is 0.
+			 */
+			inline explicit Divider(const SizeType divisor);
+
+			////////////////////////////////////////////////////////////////////
+
+
+
+			////////////////////////////////////////////////////////////////////
+			// DIVISION
+			////////////////////////////////////////////////////////////////////
+
+			/**
+			 *    @brief Gives n / divisor().
+			 */
+			inline SizeType divide(const SizeType n) const;
+
+			/**
+			 *    @brief Gives n % divisor().
+			 */
+			inline SizeType modulo(const SizeType n) const;
+
+			/**
+			 *    @brief Gives the divisor.
+			 */
+			inline SizeType divisor() const;
+
+			////////////////////////////////////////////////////////////////////
+
+		private:
+			/**
+			 *    @brief Gives the high half of the double-width product a * b.
+			 */
+			static inline SizeType multiplyHigh(const SizeType a, const SizeType b);
+
+			SizeType      _divisor;     ///< The divisor.
+			SizeType      _multiplier;  ///< The multiplicative inverse.
+			unsigned char _shift1;      ///< The first shift, 0 or 1.
+			unsigned char _shift2;      ///< The second shift.
+		};
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/Divider.inl>
+
+#endif // Divider_hpp
@@ -0,0 +1,65 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Equality_hpp
+#define Equality_hpp
+
+#include <type_traits>
+#include <DopeVector/internal/Common.hpp>
+
+namespace dope {
+
+	/**
+	 * @brief The BitwiseComparable trait tells whether two values of type T
+	 *        are equal exactly when their bytes are, so that DopeVector
+	 *        comparisons can use memcmp on contiguous runs. It holds for
+	 *        integral, enumeration and pointer types (not for floating point
+	 *        ones, because of NaN and signed zeros) and can be specialized
+	 *        for user types without padding, e.g.:
+	 *
+	 *        template < > struct BitwiseComparable<Color> : std::true_type { };
+	 */
+	template < typename T >
+	struct BitwiseComparable : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> { };
+
+	namespace internal {
+
+		/**
+		 * @brief Finds a position where two views of the same sizes differ,
+		 *        comparing rows along the last dimension (with memcmp when T is
+		 *        BitwiseComparable and both rows are dense) and splitting large
+		 *        views across threads.
+		 * @param a, b          First elements of the two views.
+		 * @param size          Sizes of the views.
+		 * @param aOffset       Offsets of the view a.
+		 * @param bOffset       Offsets of the view b.
+		 * @param first         If true the row-major first difference is
+		 *                      searched, otherwise any, whichever is found
+		 *                      first.
+		 * @return The row-major linear position of a difference, or the total
+		 *         number of elements if the views are equal.
+		 */
+		template < typename T, SizeType Dimension >
+		inline SizeType findDifference(const T *a, const T *b, const SizeType *size, const SizeType *aOffset, const SizeType *bOffset, const bool first);
+
+		/**
+		 * @brief Finds the first difference within a row of n elements.
+		 * @return The position of the difference, or n.
+		 */
+		template < typename T >
+		inline SizeType findRowDifference(const T *a, const SizeType aStride, const T *b, const SizeType bStride, const SizeType n);
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/Equality.inl>
+
+#endif // Equality_hpp
@@ -35,7 +35,6 @@ namespace dope {
 		class StaticArrayUnaryExpression : public StaticArrayExpression<StaticArrayUnaryExpression<E, T, Dimension, Op>, T, Dimension> {
 		private:
 			const E                                           &_e;
-			mutable std::array<std::function<T()>, Dimension>  _values;
 			static const Op                                    _op;
 
 		public:
@@ -51,7 +50,6 @@ namespace dope {
 		private:
 			const El                                          &_el;
 			const Er	                                          &_er;
-			mutable std::array<std::function<T()>, Dimension>  _values;
 			static const Op                                    _op;
 
 		public:
@@ -15,6 +15,7 @@
 #include <iterator>
 #include <type_traits>
 #include <DopeVector/Index.hpp>
+#include <DopeVector/internal/BoundsCheck.hpp>
 
 namespace dope {
 
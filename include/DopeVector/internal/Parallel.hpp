@@ -0,0 +1,57 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef Parallel_hpp
+#define Parallel_hpp
+
+#include <DopeVector/internal/Common.hpp>
+
+/**
+ * Minimum number of elements given to each thread by parallel operations:
+ * smaller workloads run on the calling thread only.
+ */
+#ifndef DOPE_PARALLEL_GRAIN
+	#define DOPE_PARALLEL_GRAIN (dope::SizeType(1) << 18)
+#endif
+
+/**
+ * Maximum number of threads used by parallel operations (0 means as many as
+ * std::thread::hardware_concurrency()).
+ */
+#ifndef DOPE_PARALLEL_THREADS
+	#define DOPE_PARALLEL_THREADS 0
+#endif
+
+namespace dope {
+
+	namespace internal {
+
+		/**
+		 * @brief Gives the number of threads to use for count work items of
+		 *        which each thread should get at least grain.
+		 */
+		inline SizeType parallelThreads(const SizeType count, const SizeType grain);
+
+		/**
+		 * @brief Splits [begin, end) in contiguous chunks of at least grain
+		 *        items and calls f(chunkBegin, chunkEnd) on each, in parallel
+		 *        threads. The calling thread takes the last chunk. An exception
+		 *        thrown by f is rethrown once all the chunks are done.
+		 */
+		template < class F >
+		inline void parallel_for(const SizeType begin, const SizeType end, const SizeType grain, F f);
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/Parallel.inl>
+
+#endif // Parallel_hpp
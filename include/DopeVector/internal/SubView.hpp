@@ -0,0 +1,87 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#ifndef SubView_hpp
+#define SubView_hpp
+
+#include <DopeVector/internal/BoundsCheck.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension > class DopeVector;
+
+	namespace internal {
+
+		/**
+		 * @brief The SubView class is the result of m[i] on a DopeVector m of
+		 *        more than one dimension. It only holds the address of its
+		 *        first element and pointers to the sizes and offsets of the
+		 *        remaining dimensions in m, so that m[i][j]...[k] costs one
+		 *        multiply-add (and the bounds check selected by Policy) per
+		 *        level. It converts to a DopeVector<T, Dimension>.
+		 * @param T             Type of the data.
+		 * @param Dimension     Dimension of the sub-matrix.
+		 * @param Policy        Bounds check of the originating DopeVector.
+		 * @note A SubView refers to the sizes and offsets of the DopeVector
+		 *       it comes from, so it must not outlive it: use a DopeVector to
+		 *       keep a row of a temporary matrix.
+		 */
+		template < typename T, SizeType Dimension, BoundsCheck Policy >
+		class SubView {
+		public:
+			inline SubView(T *array, const SizeType accumulatedOffset, const SizeType *size, const SizeType *offset);
+
+			/**
+			 *    @brief Gives access to the i-th sub-matrix in the first
+			 *           dimension, i.e. m[i][*]...[*].
+			 */
+			inline SubView<T, Dimension-1, Policy> operator[](const SizeType i) const;
+
+			/**
+			 *    @brief Conversion to a DopeVector, copying sizes and offsets.
+			 */
+			inline operator DopeVector<T, Dimension>() const;
+
+		private:
+			T              *_array;                 ///< Pointer in memory to the first element of this matrix.
+			SizeType        _accumulatedOffset;     ///< Offset of the first element of this matrix from the beginning of the stored array.
+			const SizeType *_size;                  ///< Sizes of this matrix, owned by the originating DopeVector.
+			const SizeType *_offset;                ///< Offsets of this matrix, owned by the originating DopeVector.
+		};
+
+		template < typename T, BoundsCheck Policy >
+		class SubView<T, 1, Policy> {
+		public:
+			inline SubView(T *array, const SizeType accumulatedOffset, const SizeType *size, const SizeType *offset);
+
+			/**
+			 *    @brief Gives access to the i-th element, i.e. m[i].
+			 */
+			inline T & operator[](const SizeType i) const;
+
+			/**
+			 *    @brief Conversion to a DopeVector, copying size and offset.
+			 */
+			inline operator DopeVector<T, 1>() const;
+
+		private:
+			T              *_array;                 ///< Pointer in memory to the first element of this vector.
+			SizeType        _accumulatedOffset;     ///< Offset of the first element of this vector from the beginning of the stored array.
+			const SizeType *_size;                  ///< Size of this vector, owned by the originating DopeVector.
+			const SizeType *_offset;                ///< Offset of this vector, owned by the originating DopeVector.
+		};
+
+	}
+
+}
+
+#include <DopeVector/internal/inlines/SubView.inl>
+
+#endif // SubView_hpp
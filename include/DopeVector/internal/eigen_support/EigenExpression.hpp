@@ -27,7 +27,6 @@ namespace dope {
 		private:
 			const Eigen::MatrixBase<Derived>                  &_el;
 			const Er	                                          &_er;
-			mutable std::array<std::function<T()>, Dimension>  _values;
 			static const Op                                    _op;
 
 		public:
@@ -45,7 +44,6 @@ namespace dope {
 		private:
 			const El                                          &_el;
 			const Eigen::MatrixBase<Derived>                  &_er;
-			mutable std::array<std::function<T()>, Dimension>  _values;
 			static const Op                                    _op;
 
 		public:
@@ -0,0 +1,107 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <cassert>
+#include <sstream>
+#include <stdexcept>
+#include <DopeVector/internal/BoundsCheck.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension >
+	constexpr BoundsCheck BoundsCheckPolicy<T, Dimension>::value;
+
+	namespace internal {
+
+		inline void throw_index_out_of_range(const SizeType i, const SizeType size)
+		{
+			std::stringstream stream;
+			stream << "Index " << i << " is out of range [0, " << size-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+
+		inline void throw_window_out_of_range(const SizeType start, const SizeType size, const SizeType available)
+		{
+			std::stringstream stream;
+			if (start >= available)
+				stream << "Index " << start << " is out of range [0, " << available << ']';
+			else
+				stream << "Window size " << size << " is out of range [" << 0 << ", " << available - start << ']';
+			throw std::out_of_range(stream.str());
+		}
+
+		inline void throw_invalid_iterator()
+		{
+			throw std::range_error("Iterator not valid.");
+		}
+
+
+
+		template < >
+		inline void Bounds<BoundsCheck::Checked>::index(const SizeType i, const SizeType size)
+		{
+			if (i >= size)
+				throw_index_out_of_range(i, size);
+		}
+
+		template < >
+		inline void Bounds<BoundsCheck::Checked>::window(const SizeType start, const SizeType size, const SizeType available)
+		{
+			if (start >= available || start + size > available)
+				throw_window_out_of_range(start, size, available);
+		}
+
+		template < >
+		inline void Bounds<BoundsCheck::Checked>::iterator(const bool valid)
+		{
+			if (!valid)
+				throw_invalid_iterator();
+		}
+
+
+
+		template < >
+		inline void Bounds<BoundsCheck::Asserted>::index(const SizeType i, const SizeType size)
+		{
+			assert(i < size);
+			(void)i; (void)size;
+		}
+
+		template < >
+		inline void Bounds<BoundsCheck::Asserted>::window(const SizeType start, const SizeType size, const SizeType available)
+		{
+			assert(start < available && start + size <= available);
+			(void)start; (void)size; (void)available;
+		}
+
+		template < >
+		inline void Bounds<BoundsCheck::Asserted>::iterator(const bool valid)
+		{
+			assert(valid);
+			(void)valid;
+		}
+
+
+
+		template < >
+		inline void Bounds<BoundsCheck::Unchecked>::index(const SizeType, const SizeType)
+		{ }
+
+		template < >
+		inline void Bounds<BoundsCheck::Unchecked>::window(const SizeType, const SizeType, const SizeType)
+		{ }
+
+		template < >
+		inline void Bounds<BoundsCheck::Unchecked>::iterator(const bool)
+		{ }
+
+	}
+
+}
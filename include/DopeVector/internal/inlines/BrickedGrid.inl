@@ -0,0 +1,249 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <DopeVector/BrickedGrid.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	constexpr SizeType BrickedGrid<T, Dimension, BrickSize, Allocator>::BrickVolume;
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline BrickedGrid<T, Dimension, BrickSize, Allocator>::BrickedGrid()
+	    : _size(IndexD::Zero())
+	    , _bricks(IndexD::Zero())
+	{ }
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline BrickedGrid<T, Dimension, BrickSize, Allocator>::BrickedGrid(const IndexD &size, const T &default_value)
+	    : BrickedGrid()
+	{
+		resize(size, default_value);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline BrickedGrid<T, Dimension, BrickSize, Allocator>::BrickedGrid(const DopeVector<T, Dimension> &o)
+	    : BrickedGrid(o.allSizes())
+	{
+		import(o);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ACCESS METHODS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline const T & BrickedGrid<T, Dimension, BrickSize, Allocator>::at(const IndexD &i) const
+	{
+		SizeType brick = static_cast<SizeType>(0), local = static_cast<SizeType>(0);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			Check::index(i[d], _size[d]);
+			brick = brick * _bricks[d] + i[d] / BrickSize;
+			local = local * BrickSize + i[d] % BrickSize;
+		}
+		return _data[brick * BrickVolume + local];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline T & BrickedGrid<T, Dimension, BrickSize, Allocator>::at(const IndexD &i)
+	{
+		return const_cast<T &>(static_cast<const BrickedGrid &>(*this).at(i));
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline const T & BrickedGrid<T, Dimension, BrickSize, Allocator>::operator[](const IndexD &i) const
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline T & BrickedGrid<T, Dimension, BrickSize, Allocator>::operator[](const IndexD &i)
+	{
+		return at(i);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BRICKS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline SizeType BrickedGrid<T, Dimension, BrickSize, Allocator>::brickCount() const
+	{
+		return _bricks.prod();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline const typename BrickedGrid<T, Dimension, BrickSize, Allocator>::IndexD & BrickedGrid<T, Dimension, BrickSize, Allocator>::allBrickCounts() const
+	{
+		return _bricks;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline DopeVector<T, Dimension> BrickedGrid<T, Dimension, BrickSize, Allocator>::brick(const SizeType b) const
+	{
+		if (b >= brickCount()) {
+			std::stringstream stream;
+			stream << "Index " << b << " is out of range [0, " << brickCount()-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		const IndexD origin = brickOrigin(b);
+		IndexD size, offset;
+		offset[Dimension-1] = 1;
+		for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d)
+			offset[d-1] = BrickSize * offset[d];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			size[d] = std::min(BrickSize, _size[d] - origin[d]);
+		return DopeVector<T, Dimension>(const_cast<T *>(_data.data()) + b * BrickVolume, b * BrickVolume, size, offset);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline DopeVector<T, Dimension> BrickedGrid<T, Dimension, BrickSize, Allocator>::brick(const IndexD &b) const
+	{
+		return brick(to_position(b, _bricks));
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline typename BrickedGrid<T, Dimension, BrickSize, Allocator>::IndexD BrickedGrid<T, Dimension, BrickSize, Allocator>::brickOrigin(const SizeType b) const
+	{
+		IndexD origin = to_index(b, _bricks);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			origin[d] *= BrickSize;
+		return origin;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERSIONS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline void BrickedGrid<T, Dimension, BrickSize, Allocator>::import(const DopeVector<T, Dimension> &o)
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		const SizeType count = brickCount();
+		for (SizeType b = static_cast<SizeType>(0); b < count; ++b) {
+			DopeVector<T, Dimension> dst = brick(b);
+			dst.import(o.window(brickOrigin(b), dst.allSizes()));
+		}
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline void BrickedGrid<T, Dimension, BrickSize, Allocator>::exportTo(DopeVector<T, Dimension> &o) const
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		const SizeType count = brickCount();
+		for (SizeType b = static_cast<SizeType>(0); b < count; ++b) {
+			const DopeVector<T, Dimension> src = brick(b);
+			DopeVector<T, Dimension> dst = o.window(brickOrigin(b), src.allSizes());
+			dst.import(src);
+		}
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline void BrickedGrid<T, Dimension, BrickSize, Allocator>::to_grid(Grid<T, Dimension, Allocator> &g) const
+	{
+		g.resize(_size);
+		exportTo(g);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline const typename BrickedGrid<T, Dimension, BrickSize, Allocator>::IndexD & BrickedGrid<T, Dimension, BrickSize, Allocator>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline SizeType BrickedGrid<T, Dimension, BrickSize, Allocator>::sizeAt(const SizeType d) const
+	{
+		if (d >= Dimension) {
+			std::stringstream stream;
+			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		return _size[d];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline SizeType BrickedGrid<T, Dimension, BrickSize, Allocator>::size() const
+	{
+		return _size.prod();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline bool BrickedGrid<T, Dimension, BrickSize, Allocator>::empty() const
+	{
+		return _data.empty();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline const T * BrickedGrid<T, Dimension, BrickSize, Allocator>::data() const
+	{
+		return _data.data();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline T * BrickedGrid<T, Dimension, BrickSize, Allocator>::data()
+	{
+		return _data.data();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RESET
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline void BrickedGrid<T, Dimension, BrickSize, Allocator>::clear()
+	{
+		_data.clear();
+		_size = IndexD::Zero();
+		_bricks = IndexD::Zero();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize, class Allocator >
+	inline void BrickedGrid<T, Dimension, BrickSize, Allocator>::resize(const IndexD &size, const T &default_value)
+	{
+		_size = size;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			_bricks[d] = (size[d] + BrickSize - 1) / BrickSize;
+		_data.assign(_bricks.prod() * BrickVolume, default_value);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
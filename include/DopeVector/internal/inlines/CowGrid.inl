@@ -0,0 +1,322 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <atomic>
+#include <utility>
+#include <DopeVector/CowGrid.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	constexpr SizeType CowGrid<T, Dimension, BrickSize>::BrickVolume;
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline CowGrid<T, Dimension, BrickSize>::CowGrid()
+	    : _size(IndexD::Zero())
+	    , _bricks(IndexD::Zero())
+	    , _table(std::make_shared<Table>())
+	{ }
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline CowGrid<T, Dimension, BrickSize>::CowGrid(const IndexD &size, const T &default_value)
+	    : CowGrid()
+	{
+		resize(size, default_value);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline CowGrid<T, Dimension, BrickSize>::CowGrid(const DopeVector<T, Dimension> &o)
+	    : CowGrid(o.allSizes())
+	{
+		import(o);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline CowGrid<T, Dimension, BrickSize>::CowGrid(CowGrid &&o)
+	    : _size(o._size)
+	    , _bricks(o._bricks)
+	    , _table(std::move(o._table))
+	{
+		o.clear();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline CowGrid<T, Dimension, BrickSize> & CowGrid<T, Dimension, BrickSize>::operator=(CowGrid &&o)
+	{
+		if (&o != this) {
+			_size = o._size;
+			_bricks = o._bricks;
+			_table = std::move(o._table);
+			o.clear();
+		}
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ACCESS METHODS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline const T & CowGrid<T, Dimension, BrickSize>::at(const IndexD &i) const
+	{
+		SizeType brick, local;
+		locate(i, brick, local);
+		return (*(*_table)[brick])[local];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline T & CowGrid<T, Dimension, BrickSize>::at(const IndexD &i)
+	{
+		SizeType brick, local;
+		locate(i, brick, local);
+		return ownBrick(brick)[local];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline const T & CowGrid<T, Dimension, BrickSize>::operator[](const IndexD &i) const
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline T & CowGrid<T, Dimension, BrickSize>::operator[](const IndexD &i)
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline CowGrid<T, Dimension, BrickSize> CowGrid<T, Dimension, BrickSize>::snapshot() const
+	{
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BRICKS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline SizeType CowGrid<T, Dimension, BrickSize>::brickCount() const
+	{
+		return static_cast<SizeType>(_table->size());
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline const typename CowGrid<T, Dimension, BrickSize>::IndexD & CowGrid<T, Dimension, BrickSize>::allBrickCounts() const
+	{
+		return _bricks;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline DopeVector<T, Dimension> CowGrid<T, Dimension, BrickSize>::brick(const SizeType b) const
+	{
+		if (b >= brickCount()) {
+			std::stringstream stream;
+			stream << "Index " << b << " is out of range [0, " << brickCount()-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		const IndexD origin = brickOrigin(b);
+		IndexD size, offset;
+		offset[Dimension-1] = 1;
+		for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d)
+			offset[d-1] = BrickSize * offset[d];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			size[d] = std::min(BrickSize, _size[d] - origin[d]);
+		return DopeVector<T, Dimension>(const_cast<T *>((*_table)[b]->data()), static_cast<SizeType>(0), size, offset);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline DopeVector<T, Dimension> CowGrid<T, Dimension, BrickSize>::writableBrick(const SizeType b)
+	{
+		if (b < brickCount())
+			ownBrick(b);
+		return brick(b);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline typename CowGrid<T, Dimension, BrickSize>::IndexD CowGrid<T, Dimension, BrickSize>::brickOrigin(const SizeType b) const
+	{
+		IndexD origin = to_index(b, _bricks);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			origin[d] *= BrickSize;
+		return origin;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline bool CowGrid<T, Dimension, BrickSize>::isShared(const SizeType b) const
+	{
+		return _table.use_count() > 1 || (*_table).at(b).use_count() > 1;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERSIONS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline void CowGrid<T, Dimension, BrickSize>::import(const DopeVector<T, Dimension> &o)
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		Table &table = ownTable();
+		const SizeType count = brickCount();
+		for (SizeType b = static_cast<SizeType>(0); b < count; ++b) {
+			// a shared brick would be overwritten anyway: replace it
+			if (table[b].use_count() > 1)
+				table[b] = std::make_shared<Brick>(BrickVolume);
+			DopeVector<T, Dimension> dst = brick(b);
+			dst.import(o.window(brickOrigin(b), dst.allSizes()));
+		}
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline void CowGrid<T, Dimension, BrickSize>::exportTo(DopeVector<T, Dimension> &o) const
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		const SizeType count = brickCount();
+		for (SizeType b = static_cast<SizeType>(0); b < count; ++b) {
+			const DopeVector<T, Dimension> src = brick(b);
+			DopeVector<T, Dimension> dst = o.window(brickOrigin(b), src.allSizes());
+			dst.import(src);
+		}
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline void CowGrid<T, Dimension, BrickSize>::to_grid(Grid<T, Dimension> &g) const
+	{
+		g.resize(_size);
+		if (!empty())
+			exportTo(g);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline const typename CowGrid<T, Dimension, BrickSize>::IndexD & CowGrid<T, Dimension, BrickSize>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline SizeType CowGrid<T, Dimension, BrickSize>::sizeAt(const SizeType d) const
+	{
+		if (d >= Dimension) {
+			std::stringstream stream;
+			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		return _size[d];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline SizeType CowGrid<T, Dimension, BrickSize>::size() const
+	{
+		return _size.prod();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline bool CowGrid<T, Dimension, BrickSize>::empty() const
+	{
+		return _table->empty();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RESET
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline void CowGrid<T, Dimension, BrickSize>::clear()
+	{
+		_table = std::make_shared<Table>();
+		_size = IndexD::Zero();
+		_bricks = IndexD::Zero();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline void CowGrid<T, Dimension, BrickSize>::resize(const IndexD &size, const T &default_value)
+	{
+		_size = size;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			_bricks[d] = (size[d] + BrickSize - 1) / BrickSize;
+		const SizeType count = _bricks.prod();
+		// all the bricks start sharing one buffer of default values
+		_table = std::make_shared<Table>(count, count > static_cast<SizeType>(0) ? std::make_shared<Brick>(BrickVolume, default_value) : std::shared_ptr<Brick>());
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COPY-ON-WRITE
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline typename CowGrid<T, Dimension, BrickSize>::Table & CowGrid<T, Dimension, BrickSize>::ownTable()
+	{
+		if (_table.use_count() > 1)
+			_table = std::make_shared<Table>(*_table);
+		else
+			// the last other owner released it with a release decrement
+			std::atomic_thread_fence(std::memory_order_acquire);
+		return *_table;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline typename CowGrid<T, Dimension, BrickSize>::Brick & CowGrid<T, Dimension, BrickSize>::ownBrick(const SizeType b)
+	{
+		std::shared_ptr<Brick> &brick = ownTable()[b];
+		if (brick.use_count() > 1)
+			brick = std::make_shared<Brick>(*brick);
+		else
+			std::atomic_thread_fence(std::memory_order_acquire);
+		return *brick;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BrickSize >
+	inline void CowGrid<T, Dimension, BrickSize>::locate(const IndexD &i, SizeType &brick, SizeType &local) const
+	{
+		brick = static_cast<SizeType>(0);
+		local = static_cast<SizeType>(0);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			Check::index(i[d], _size[d]);
+			brick = brick * _bricks[d] + i[d] / BrickSize;
+			local = local * BrickSize + i[d] % BrickSize;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
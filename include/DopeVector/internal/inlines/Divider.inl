@@ -0,0 +1,105 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <limits>
+#include <stdexcept>
+#include <DopeVector/internal/Divider.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		////////////////////////////////////////////////////////////////////////
+		// CONSTRUCTORS
+		////////////////////////////////////////////////////////////////////////
+
+		inline Divider::Divider()
+		    : _divisor(static_cast<SizeType>(1))
+		    , _multiplier(static_cast<SizeType>(1))
+		    , _shift1(0)
+		    , _shift2(0)
+		{ }
+
+		inline Divider::Divider(const SizeType divisor)
+		    : _divisor(divisor)
+		{
+			if (divisor == static_cast<SizeType>(0))
+				throw std::overflow_error("Divide by zero exception");
+			const unsigned int bits = std::numeric_limits<SizeType>::digits;
+			// l = ceil(log2(divisor))
+			unsigned int l = 0;
+			while (l < bits && (static_cast<SizeType>(1) << l) < divisor)
+				++l;
+			// multiplier = floor(2^bits * (2^l - divisor) / divisor) + 1, by
+			// long division: the remainder 2^l - divisor is less than divisor
+			SizeType remainder = (l < bits ? static_cast<SizeType>(1) << l : static_cast<SizeType>(0)) - divisor;
+			SizeType quotient = static_cast<SizeType>(0);
+			for (unsigned int i = 0; i < bits; ++i) {
+				const bool carry = (remainder >> (bits - 1)) != static_cast<SizeType>(0);
+				remainder <<= 1;
+				quotient <<= 1;
+				if (carry || remainder >= divisor) {
+					remainder -= divisor;
+					quotient |= static_cast<SizeType>(1);
+				}
+			}
+			_multiplier = quotient + static_cast<SizeType>(1);
+			_shift1 = static_cast<unsigned char>(l < 1 ? l : 1);
+			_shift2 = static_cast<unsigned char>(l < 1 ? 0 : l - 1);
+		}
+
+		////////////////////////////////////////////////////////////////////////
+
+
+
+		////////////////////////////////////////////////////////////////////////
+		// DIVISION
+		////////////////////////////////////////////////////////////////////////
+
+		inline SizeType Divider::divide(const SizeType n) const
+		{
+			const SizeType t = multiplyHigh(_multiplier, n);
+			return (t + ((n - t) >> _shift1)) >> _shift2;
+		}
+
+		inline SizeType Divider::modulo(const SizeType n) const
+		{
+			return n - divide(n) * _divisor;
+		}
+
+		inline SizeType Divider::divisor() const
+		{
+			return _divisor;
+		}
+
+		inline SizeType Divider::multiplyHigh(const SizeType a, const SizeType b)
+		{
+			const unsigned int bits = std::numeric_limits<SizeType>::digits;
+#if defined(__SIZEOF_INT128__)
+			__extension__ typedef unsigned __int128 Wide;
+			if (bits == 64)
+				return static_cast<SizeType>((static_cast<Wide>(a) * b) >> 64);
+#endif
+			if (bits <= 32)
+				return static_cast<SizeType>((static_cast<unsigned long long>(a) * b) >> (bits <= 32 ? bits : 0));
+			// schoolbook product of the halves
+			const unsigned int half = bits / 2;
+			const SizeType mask = (static_cast<SizeType>(1) << half) - static_cast<SizeType>(1);
+			const SizeType a0 = a & mask, a1 = a >> half, b0 = b & mask, b1 = b >> half;
+			const SizeType p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+			const SizeType middle = (p00 >> half) + (p01 & mask) + (p10 & mask);
+			return p11 + (p01 >> half) + (p10 >> half) + (middle >> half);
+		}
+
+		////////////////////////////////////////////////////////////////////////
+
+	}
+
+}
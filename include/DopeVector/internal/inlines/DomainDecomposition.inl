@@ -0,0 +1,267 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <DopeVector/DomainDecomposition.hpp>
+#include <DopeVector/internal/Parallel.hpp>
+
+namespace dope {
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline DomainDecomposition<T, Dimension, Allocator>::DomainDecomposition()
+	    : _size(IndexD::Zero())
+	    , _parts(IndexD::Zero())
+	    , _ghost(static_cast<SizeType>(0))
+	    , _periodic()
+	{ }
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline DomainDecomposition<T, Dimension, Allocator>::DomainDecomposition(const IndexD &size, const IndexD &parts, const SizeType ghost, const Periodicity &periodic, const T &default_value)
+	    : _size(size)
+	    , _parts(parts)
+	    , _ghost(ghost)
+	    , _periodic(periodic)
+	{
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			if (parts[d] == static_cast<SizeType>(0) || parts[d] > size[d])
+				throw std::invalid_argument("Cannot split a dimension in more blocks than elements, or in none.");
+			if ((parts[d] > static_cast<SizeType>(1) || periodic[d]) && ghost > size[d] / parts[d])
+				throw std::invalid_argument("The ghost layers are wider than a neighbour subdomain.");
+			const SizeType width = size[d] / parts[d], rest = size[d] % parts[d];
+			_splits[d].resize(parts[d] + 1);
+			_splits[d][0] = static_cast<SizeType>(0);
+			for (SizeType b = static_cast<SizeType>(0); b < parts[d]; ++b)
+				_splits[d][b+1] = _splits[d][b] + width + (b < rest ? static_cast<SizeType>(1) : static_cast<SizeType>(0));
+		}
+
+		_locals.reserve(parts.prod());
+		for (SizeType k = static_cast<SizeType>(0); k < parts.prod(); ++k)
+			_locals.emplace_back(interiorSize(k) + IndexD::Constant(2 * ghost), default_value);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline DomainDecomposition<T, Dimension, Allocator>::DomainDecomposition(const IndexD &size, const IndexD &parts, const SizeType ghost, const bool periodic, const T &default_value)
+	    : DomainDecomposition(size, parts, ghost, internal::uniformPeriodicity<Dimension>(periodic), default_value)
+	{ }
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// SUBDOMAINS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SizeType DomainDecomposition<T, Dimension, Allocator>::subdomainCount() const
+	{
+		return static_cast<SizeType>(_locals.size());
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline typename DomainDecomposition<T, Dimension, Allocator>::IndexD DomainDecomposition<T, Dimension, Allocator>::block(const SizeType k) const
+	{
+		return to_index(k, _parts);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline typename DomainDecomposition<T, Dimension, Allocator>::IndexD DomainDecomposition<T, Dimension, Allocator>::origin(const SizeType k) const
+	{
+		const IndexD b = block(k);
+		IndexD start;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			start[d] = _splits[d][b[d]];
+		return start;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline typename DomainDecomposition<T, Dimension, Allocator>::IndexD DomainDecomposition<T, Dimension, Allocator>::interiorSize(const SizeType k) const
+	{
+		const IndexD b = block(k);
+		IndexD size;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			size[d] = _splits[d][b[d]+1] - _splits[d][b[d]];
+		return size;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const typename DomainDecomposition<T, Dimension, Allocator>::Local & DomainDecomposition<T, Dimension, Allocator>::local(const SizeType k) const
+	{
+		check(k);
+		return _locals[k];
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline typename DomainDecomposition<T, Dimension, Allocator>::Local & DomainDecomposition<T, Dimension, Allocator>::local(const SizeType k)
+	{
+		check(k);
+		return _locals[k];
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline DopeVector<T, Dimension> DomainDecomposition<T, Dimension, Allocator>::interior(const SizeType k) const
+	{
+		return local(k).window(IndexD::Constant(_ghost), interiorSize(k));
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void DomainDecomposition<T, Dimension, Allocator>::check(const SizeType k) const
+	{
+		if (k >= subdomainCount()) {
+			std::stringstream stream;
+			stream << "Index " << k << " is out of range [0, " << subdomainCount()-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// COPIES
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void DomainDecomposition<T, Dimension, Allocator>::load(const DopeVector<T, Dimension> &domain)
+	{
+		if (domain.allSizes() != _size)
+			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_TRACE_SCOPE("DomainDecomposition::load");
+		internal::parallel_for(static_cast<SizeType>(0), subdomainCount(), static_cast<SizeType>(1), [&](const SizeType from, const SizeType to) {
+			for (SizeType k = from; k < to; ++k)
+				interior(k).import(domain.window(origin(k), interiorSize(k)));
+		});
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void DomainDecomposition<T, Dimension, Allocator>::store(const DopeVector<T, Dimension> &domain) const
+	{
+		if (domain.allSizes() != _size)
+			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_TRACE_SCOPE("DomainDecomposition::store");
+		internal::parallel_for(static_cast<SizeType>(0), subdomainCount(), static_cast<SizeType>(1), [&](const SizeType from, const SizeType to) {
+			for (SizeType k = from; k < to; ++k)
+				domain.window(origin(k), interiorSize(k)).import(interior(k));
+		});
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void DomainDecomposition<T, Dimension, Allocator>::exchange()
+	{
+		if (_ghost == static_cast<SizeType>(0) || _locals.empty())
+			return;
+
+		DOPE_TRACE_SCOPE("DomainDecomposition::exchange");
+		// one work item per subdomain and direction towards a neighbour:
+		// digit d of the direction in base 3 is 0, 1 or 2 for a neighbour
+		// before, aligned or after along dimension d
+		const SizeType directions = internal::power(3, Dimension);
+		internal::parallel_for(static_cast<SizeType>(0), subdomainCount() * directions, static_cast<SizeType>(1), [&](const SizeType from, const SizeType to) {
+			IndexD dstStart, srcStart, size;
+			for (SizeType item = from; item < to; ++item) {
+				const SizeType k = item / directions;
+				SizeType direction = item % directions;
+				if (direction == (directions - 1) / 2)
+					continue;   // the interior itself
+				IndexD b = block(k);
+				const IndexD own = interiorSize(k);
+				bool inside = true;
+				for (SizeType d = static_cast<SizeType>(0); d < Dimension && inside; ++d, direction /= 3) {
+					const SizeType n = own[d];
+					switch (direction % 3) {
+					case 0:
+						if (b[d] == static_cast<SizeType>(0)) {
+							inside = _periodic[d];
+							b[d] = _parts[d];
+						}
+						--b[d];
+						dstStart[d] = static_cast<SizeType>(0);
+						srcStart[d] = _splits[d][b[d]+1] - _splits[d][b[d]];   // its last interior layers
+						size[d] = _ghost;
+						break;
+					case 1:
+						dstStart[d] = _ghost;
+						srcStart[d] = _ghost;
+						size[d] = n;
+						break;
+					default:
+						if (++b[d] == _parts[d]) {
+							inside = _periodic[d];
+							b[d] = static_cast<SizeType>(0);
+						}
+						dstStart[d] = _ghost + n;
+						srcStart[d] = _ghost;   // its first interior layers
+						size[d] = _ghost;
+						break;
+					}
+				}
+				if (!inside)
+					continue;   // outside a non-periodic border
+				_locals[k].window(dstStart, size).import(_locals[to_position(b, _parts)].window(srcStart, size));
+			}
+		});
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const typename DomainDecomposition<T, Dimension, Allocator>::IndexD & DomainDecomposition<T, Dimension, Allocator>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const typename DomainDecomposition<T, Dimension, Allocator>::IndexD & DomainDecomposition<T, Dimension, Allocator>::parts() const
+	{
+		return _parts;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SizeType DomainDecomposition<T, Dimension, Allocator>::ghostWidth() const
+	{
+		return _ghost;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const typename DomainDecomposition<T, Dimension, Allocator>::Periodicity & DomainDecomposition<T, Dimension, Allocator>::periodicity() const
+	{
+		return _periodic;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	namespace internal {
+
+		template < SizeType Dimension >
+		inline std::array<bool, Dimension> uniformPeriodicity(const bool periodic)
+		{
+			std::array<bool, Dimension> all;
+			all.fill(periodic);
+			return all;
+		}
+
+	}
+
+}
@@ -8,9 +8,11 @@
 // Author: Maurizio Kovacic
 // email: maurizio.kovacic@gmail.com
 
+#include <algorithm>
 #include <memory>
 #include <array>
 #include <DopeVector/DopeVector.hpp>
+#include <DopeVector/internal/Parallel.hpp>
 
 namespace dope {
 
@@ -86,8 +88,16 @@ namespace dope {
 			return;
 		if (_size[0] != o._size[0])
 			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_INSTRUMENT_SCOPE(Operation::Import);
+		DOPE_TRACE_SCOPE("DopeVector::import");
+		if (_size == o._size && isContiguous() && o.isContiguous() && !internal::overlap(_array, o._array, size())) {
+			// dense views of the same shape: one linear copy
+			DOPE_INSTRUMENT_COPY(size(), size() * sizeof(T));
+			std::copy(o._array, o._array + o.size(), _array);
+			return;
+		}
 		for (SizeType i = static_cast<SizeType>(0); i < _size[0]; ++i)
-			operator[](i).import(o[i]);
+			at(i).import(o.at(i));
 	}
 
 	template < typename T, SizeType Dimension >
@@ -97,7 +107,10 @@ namespace dope {
 			return;
 		if (allSizes() != o.allSizes())
 			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_INSTRUMENT_SCOPE(Operation::SafeImport);
+		DOPE_TRACE_SCOPE("DopeVector::safeImport");
 		std::unique_ptr<T[]> tempPtr(new T[o.size()]);
+		DOPE_INSTRUMENT_ALLOCATION();
 		DopeVector<T, Dimension> tmpDopeVector(tempPtr.get(), static_cast<SizeType>(0), o.allSizes());
 		tmpDopeVector.import(o);
 		import(tmpDopeVector);
@@ -111,20 +124,25 @@ namespace dope {
 	// ACCESS METHODS
 	////////////////////////////////////////////////////////////////////////
 
+	template < typename T, SizeType Dimension >
+	inline T & DopeVector<T, Dimension>::element(const IndexD &i) const
+	{
+		SizeType offset = static_cast<SizeType>(0);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			offset += i[d] * _offset[d];
+		return *(_array + offset);
+	}
+
 	template < typename T, SizeType Dimension >
 	inline void DopeVector<T, Dimension>::at(const SizeType i, DopeVector<T, Dimension-1> &s) const
 	{
-		if (i >= _size[0]) {
-			std::stringstream stream;
-			stream << "Index " << i << " is out of range [0, " << _size[0]-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(i, _size[0]);
 		Index<Dimension-1> new_size, new_offset;
 		for (SizeType j = static_cast<SizeType>(1); j < Dimension; ++j) {
 			new_size[j-1] = _size[j];
 			new_offset[j-1] = _offset[j];
 		}
-		s.reset(_array + _offset[0] * i, accumulatedOffset(i), new_size, new_offset);
+		s.reset(_array + _offset[0] * i, _accumulatedOffset + _offset[0] * i, new_size, new_offset);
 	}
 
 	template < typename T, SizeType Dimension >
@@ -138,27 +156,24 @@ namespace dope {
 	template < typename T, SizeType Dimension >
 	inline const T & DopeVector<T, Dimension>::at(const IndexD &i) const
 	{
-		SizeType offset = static_cast<SizeType>(0);
-		for(SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
-			offset += i[d] * _offset[d];
-		return *(_array + offset);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			Check::index(i[d], _size[d]);
+		return element(i);
 	}
 
 	template < typename T, SizeType Dimension >
 	inline T & DopeVector<T, Dimension>::at(const IndexD &i)
 	{
-		SizeType offset = static_cast<SizeType>(0);
-		for(SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
-			offset += i[d] * _offset[d];
-		return *(_array + offset);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			Check::index(i[d], _size[d]);
+		return element(i);
 	}
 
 	template < typename T, SizeType Dimension >
-	inline DopeVector<T, Dimension-1> DopeVector<T, Dimension>::operator[](const SizeType i) const
+	inline typename DopeVector<T, Dimension>::SubView DopeVector<T, Dimension>::operator[](const SizeType i) const
 	{
-		DopeVector<T, Dimension-1> s;
-		at(i, s);
-		return s;
+		Check::index(i, _size[0]);
+		return SubView(_array + _offset[0] * i, _accumulatedOffset + _offset[0] * i, _size.data() + 1, _offset.data() + 1);
 	}
 
 	template < typename T, SizeType Dimension >
@@ -173,6 +188,97 @@ namespace dope {
 		return at(i);
 	}
 
+	template < typename T, SizeType Dimension >
+	inline void DopeVector<T, Dimension>::gather(const IndexD *indices, const SizeType count, T *out) const
+	{
+		DOPE_TRACE_SCOPE("DopeVector::gather");
+		forEachIndex(indices, count, DOPE_PARALLEL_GRAIN, [&](const SizeType n, const SizeType offset) {
+			out[n] = _array[offset];
+		});
+	}
+
+	template < typename T, SizeType Dimension >
+	inline void DopeVector<T, Dimension>::gather(const SizeType *positions, const SizeType count, T *out) const
+	{
+		DOPE_TRACE_SCOPE("DopeVector::gather");
+		forEachPosition(positions, count, DOPE_PARALLEL_GRAIN, [&](const SizeType n, const SizeType offset) {
+			out[n] = _array[offset];
+		});
+	}
+
+	template < typename T, SizeType Dimension >
+	inline void DopeVector<T, Dimension>::scatter(const IndexD *indices, const SizeType count, const T *values)
+	{
+		DOPE_TRACE_SCOPE("DopeVector::scatter");
+		// a single chunk: repeated elements keep their last value
+		forEachIndex(indices, count, count, [&](const SizeType n, const SizeType offset) {
+			_array[offset] = values[n];
+		});
+	}
+
+	template < typename T, SizeType Dimension >
+	inline void DopeVector<T, Dimension>::scatter(const SizeType *positions, const SizeType count, const T *values)
+	{
+		DOPE_TRACE_SCOPE("DopeVector::scatter");
+		// a single chunk: repeated elements keep their last value
+		forEachPosition(positions, count, count, [&](const SizeType n, const SizeType offset) {
+			_array[offset] = values[n];
+		});
+	}
+
+	template < typename T, SizeType Dimension >
+	template < class F >
+	inline void DopeVector<T, Dimension>::forEachIndex(const IndexD *indices, const SizeType count, const SizeType grain, F f) const
+	{
+		internal::parallel_for(static_cast<SizeType>(0), count, grain, [&](const SizeType from, const SizeType to) {
+			// local copies, which the output can not alias
+			SizeType size[Dimension], jump[Dimension];
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				size[d] = _size[d];
+				jump[d] = _offset[d];
+			}
+			for (SizeType n = from; n < to; ++n) {
+				SizeType offset = static_cast<SizeType>(0);
+				for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+					Check::index(indices[n][d], size[d]);
+					offset += indices[n][d] * jump[d];
+				}
+				f(n, offset);
+			}
+		});
+	}
+
+	template < typename T, SizeType Dimension >
+	template < class F >
+	inline void DopeVector<T, Dimension>::forEachPosition(const SizeType *positions, const SizeType count, const SizeType grain, F f) const
+	{
+		const SizeType total = size();
+		const bool contiguous = isContiguous();
+		internal::parallel_for(static_cast<SizeType>(0), count, grain, [&](const SizeType from, const SizeType to) {
+			if (contiguous) {
+				for (SizeType n = from; n < to; ++n) {
+					Check::index(positions[n], total);
+					f(n, positions[n]);
+				}
+				return;
+			}
+			SizeType size[Dimension], jump[Dimension];
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				size[d] = _size[d];
+				jump[d] = _offset[d];
+			}
+			for (SizeType n = from; n < to; ++n) {
+				Check::index(positions[n], total);
+				SizeType rest = positions[n], offset = static_cast<SizeType>(0);
+				for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+					offset += (rest % size[d-1]) * jump[d-1];
+					rest /= size[d-1];
+				}
+				f(n, offset);
+			}
+		});
+	}
+
 	////////////////////////////////////////////////////////////////////////
 
 
@@ -265,16 +371,8 @@ namespace dope {
 	template < typename T, SizeType Dimension >
 	inline void DopeVector<T, Dimension>::slice(const SizeType d, const SizeType i, DopeVector<T, Dimension-1> &s) const
 	{
-		if (d >= Dimension) {
-			std::stringstream stream;
-			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
-		if (i >= _size[d]) {
-			std::stringstream stream;
-			stream << "Index " << i << " is out of range [0, " << _size[d]-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(d, Dimension);
+		Check::index(i, _size[d]);
 		Index<Dimension-1> new_size, new_offset;
 		SizeType k = 0;
 		for (SizeType j = static_cast<SizeType>(0); j < d; ++j, ++k) {
@@ -285,7 +383,7 @@ namespace dope {
 			new_size[k] = _size[j];
 			new_offset[k] = _offset[j];
 		}
-		s.reset(_array + _offset[d] * i, accumulatedOffset(i, d), new_size, new_offset);
+		s.reset(_array + _offset[d] * i, _accumulatedOffset + _offset[d] * i, new_size, new_offset);
 	}
 
 	template < typename T, SizeType Dimension >
@@ -332,18 +430,8 @@ namespace dope {
 	template < typename T, SizeType Dimension >
 	inline void DopeVector<T, Dimension>::window(const IndexD &start, const IndexD &size, DopeVector<T, Dimension> &w) const
 	{
-		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
-			if (start[d] >= _size[d]) {
-				std::stringstream stream;
-				stream << "Index " << start[d] << " is out of range [0, " << _size[d] << ']';
-				throw std::out_of_range(stream.str());
-			}
-			if (start[d] + size[d] > _size[d]) {
-				std::stringstream stream;
-				stream << "Window size " << size[d] << " is out of range [" << 0 << ", " << _size[d] - start[d] << ']';
-				throw std::out_of_range(stream.str());
-			}
-		}
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			Check::window(start[d], size[d], _size[d]);
 		SizeType newAccumulatedOffset = _accumulatedOffset;
 		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
 			newAccumulatedOffset += _offset[d] * start[d];
@@ -369,11 +457,7 @@ namespace dope {
 	template < typename T, SizeType Dimension >
 	inline SizeType DopeVector<T, Dimension>::sizeAt(const SizeType d) const
 	{
-		if (d >= Dimension) {
-			std::stringstream stream;
-			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(d, Dimension);
 		return _size[d];
 	}
 
@@ -399,13 +483,21 @@ namespace dope {
 	}
 
 	template < typename T, SizeType Dimension >
-	inline SizeType DopeVector<T, Dimension>::offsetAt(const SizeType d) const
+	inline bool DopeVector<T, Dimension>::isContiguous() const
 	{
-		if (d >= Dimension) {
-			std::stringstream stream;
-			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
-			throw std::out_of_range(stream.str());
+		SizeType expected = static_cast<SizeType>(1);
+		for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+			if (_size[d-1] > static_cast<SizeType>(1) && _offset[d-1] != expected)
+				return false;
+			expected *= _size[d-1];
 		}
+		return true;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType DopeVector<T, Dimension>::offsetAt(const SizeType d) const
+	{
+		Check::index(d, Dimension);
 		return _offset[d];
 	}
 
@@ -421,20 +513,18 @@ namespace dope {
 		return _offset;
 	}
 
+	template < typename T, SizeType Dimension >
+	inline Layout<Dimension> DopeVector<T, Dimension>::layout() const
+	{
+		return Layout<Dimension>(_size, _offset);
+	}
+
 	template < typename T, SizeType Dimension >
 	inline SizeType DopeVector<T, Dimension>::accumulatedOffset(const SizeType i, const SizeType d) const
 	{
-		if (d >= Dimension) {
-			std::stringstream stream;
-			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
-		if (i >= _size[d]) {
-			std::stringstream stream;
-			stream << "Index " << i << " is out of range [0, " << _size[d]-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
-		return  _accumulatedOffset + _offset[d] * i;
+		Check::index(d, Dimension);
+		Check::index(i, _size[d]);
+		return _accumulatedOffset + _offset[d] * i;
 	}
 
 	template < typename T, SizeType Dimension >
@@ -442,11 +532,7 @@ namespace dope {
 	{
 		SizeType accumulatedOffset = _accumulatedOffset;
 		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
-			if (d >= _size[d]) {
-				std::stringstream stream;
-				stream << "Index " << d << " is out of range [0, " << _size[d]-1 << ']';
-				throw std::out_of_range(stream.str());
-			}
+			Check::index(index[d], _size[d]);
 			accumulatedOffset += index[d] * _offset[d];
 		}
 		return accumulatedOffset;
@@ -467,10 +553,7 @@ namespace dope {
 			return true;
 		if (_size != r._size)
 			return false;
-		for (SizeType i = static_cast<SizeType>(0); i < _size[0]; ++i)
-			if (at(i) != r.at(i))
-				return false;
-		return true;
+		return internal::findDifference<T, Dimension>(_array, r._array, _size.data(), _offset.data(), r._offset.data(), false) == size();
 	}
 
 	template < typename T, SizeType Dimension >
@@ -479,6 +562,21 @@ namespace dope {
 		return !(*this == r);
 	}
 
+	template < typename T, SizeType Dimension >
+	inline bool DopeVector<T, Dimension>::firstMismatch(const DopeVector<T, Dimension> &r, IndexD &index) const
+	{
+		if (_size != r._size)
+			throw std::out_of_range("Matrixes do not have same size.");
+		SizeType position = internal::findDifference<T, Dimension>(_array, r._array, _size.data(), _offset.data(), r._offset.data(), true);
+		if (position == size())
+			return false;
+		for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+			index[d-1] = position % _size[d-1];
+			position /= _size[d-1];
+		}
+		return true;
+	}
+
     ////////////////////////////////////////////////////////////////////////
 
 
@@ -580,6 +678,13 @@ namespace dope {
 			return;
 		if (_size[0] != o._size[0])
 			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_INSTRUMENT_SCOPE(Operation::Import);
+		DOPE_TRACE_SCOPE("DopeVector::import");
+		DOPE_INSTRUMENT_COPY(_size[0], _size[0] * sizeof(T));
+		if (isContiguous() && o.isContiguous() && !internal::overlap(_array, o._array, _size[0])) {
+			std::copy(o._array, o._array + _size[0], _array);
+			return;
+		}
 		for (SizeType i = static_cast<SizeType>(0); i < _size[0]; ++i)
 			at(i) = o.at(i);
 	}
@@ -591,7 +696,10 @@ namespace dope {
 			return;
 		if (sizeAt(0) != o.sizeAt(0))
 			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_INSTRUMENT_SCOPE(Operation::SafeImport);
+		DOPE_TRACE_SCOPE("DopeVector::safeImport");
 		std::unique_ptr<T[]> tempPtr(new T[o.size()]);
+		DOPE_INSTRUMENT_ALLOCATION();
 		DopeVector<T, 1> tmpDopeVector(tempPtr.get(), static_cast<SizeType>(0), o.allSizes());
 		tmpDopeVector.import(o);
 		import(tmpDopeVector);
@@ -605,25 +713,23 @@ namespace dope {
 	// ACCESS METHODS
 	////////////////////////////////////////////////////////////////////////
 
+	template < typename T >
+	inline T & DopeVector<T, 1>::element(const Index1 &i) const
+	{
+		return *(_array + i[0] * _offset[0]);
+	}
+
 	template < typename T >
 	inline const T & DopeVector<T, 1>::at(const SizeType i) const
 	{
-		if (i >= _size[0]) {
-			std::stringstream stream;
-			stream << "Index " << i << " is out of range [0, " << _size[0]-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(i, _size[0]);
 		return *(_array + i * _offset[0]);
 	}
 
 	template < typename T >
 	inline T & DopeVector<T, 1>::at(const SizeType i)
 	{
-		if (i >= _size[0]) {
-			std::stringstream stream;
-			stream << "Index " << i << " is out of range [0, " << _size[0]-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(i, _size[0]);
 		return *(_array + i * _offset[0]);
 	}
 
@@ -663,6 +769,54 @@ namespace dope {
 		return at(i[0]);
 	}
 
+	template < typename T >
+	inline void DopeVector<T, 1>::gather(const Index1 *indices, const SizeType count, T *out) const
+	{
+		DOPE_TRACE_SCOPE("DopeVector::gather");
+		const SizeType size = _size[0], jump = _offset[0];
+		internal::parallel_for(static_cast<SizeType>(0), count, DOPE_PARALLEL_GRAIN, [&](const SizeType from, const SizeType to) {
+			for (SizeType n = from; n < to; ++n) {
+				Check::index(indices[n][0], size);
+				out[n] = _array[indices[n][0] * jump];
+			}
+		});
+	}
+
+	template < typename T >
+	inline void DopeVector<T, 1>::gather(const SizeType *positions, const SizeType count, T *out) const
+	{
+		DOPE_TRACE_SCOPE("DopeVector::gather");
+		const SizeType size = _size[0], jump = _offset[0];
+		internal::parallel_for(static_cast<SizeType>(0), count, DOPE_PARALLEL_GRAIN, [&](const SizeType from, const SizeType to) {
+			for (SizeType n = from; n < to; ++n) {
+				Check::index(positions[n], size);
+				out[n] = _array[positions[n] * jump];
+			}
+		});
+	}
+
+	template < typename T >
+	inline void DopeVector<T, 1>::scatter(const Index1 *indices, const SizeType count, const T *values)
+	{
+		DOPE_TRACE_SCOPE("DopeVector::scatter");
+		const SizeType size = _size[0], jump = _offset[0];
+		for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+			Check::index(indices[n][0], size);
+			_array[indices[n][0] * jump] = values[n];
+		}
+	}
+
+	template < typename T >
+	inline void DopeVector<T, 1>::scatter(const SizeType *positions, const SizeType count, const T *values)
+	{
+		DOPE_TRACE_SCOPE("DopeVector::scatter");
+		const SizeType size = _size[0], jump = _offset[0];
+		for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+			Check::index(positions[n], size);
+			_array[positions[n] * jump] = values[n];
+		}
+	}
+
 	////////////////////////////////////////////////////////////////////////
 
 
@@ -778,16 +932,7 @@ namespace dope {
 	template < typename T >
 	inline void DopeVector<T, 1>::window(const Index1 &start, const Index1 &size, DopeVector<T, 1> &w) const
 	{
-		if (start[0] >= _size[0]) {
-			std::stringstream stream;
-			stream << "Index " << start[0] << " is out of range [0, " << _size[0] << ']';
-			throw std::out_of_range(stream.str());
-		}
-		if (start[0] + size[0] > _size[0]) {
-			std::stringstream stream;
-			stream << "Window size " << size[0] << " is out of range [" << 0 << ", " << _size[0] - start[0] << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::window(start[0], size[0], _size[0]);
 		SizeType accumulatedOffset = _accumulatedOffset + _offset[0] * start[0];
 		w.reset(_array + (accumulatedOffset - _accumulatedOffset), accumulatedOffset, size, _offset);
 	}
@@ -825,11 +970,7 @@ namespace dope {
 	template < typename T >
 	inline SizeType DopeVector<T, 1>::sizeAt(const SizeType d) const
 	{
-		if (d >= static_cast<SizeType>(1)) {
-			std::stringstream stream;
-			stream << "Index " << d << " is out of range [0, " << static_cast<SizeType>(0) << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(d, static_cast<SizeType>(1));
 		return _size[0];
 	}
 
@@ -851,15 +992,17 @@ namespace dope {
 		return _size[0];
 	}
 
+	template < typename T >
+	inline bool DopeVector<T, 1>::isContiguous() const
+	{
+		return _size[0] <= static_cast<SizeType>(1) || _offset[0] == static_cast<SizeType>(1);
+	}
+
 	template < typename T >
 	inline SizeType DopeVector<T, 1>::offsetAt(const SizeType d) const
 	{
-		if (d >= static_cast<SizeType>(1)) {
-			std::stringstream stream;
-			stream << "Index " << d << " is out of range [0, " << static_cast<SizeType>(0) << ']';
-			throw std::out_of_range(stream.str());
-		}
-		return _size[0];
+		Check::index(d, static_cast<SizeType>(1));
+		return _offset[0];
 	}
 
 	template < typename T >
@@ -874,14 +1017,16 @@ namespace dope {
 		return _offset;
 	}
 
+	template < typename T >
+	inline Layout<1> DopeVector<T, 1>::layout() const
+	{
+		return Layout<1>(_size, _offset);
+	}
+
 	template < typename T >
 	inline SizeType DopeVector<T, 1>::accumulatedOffset(const SizeType i) const
 	{
-		if (i >= _size[0]) {
-			std::stringstream stream;
-			stream << "Index " << i << " is out of range [0, " << _size[0]-1 << ']';
-			throw std::out_of_range(stream.str());
-		}
+		Check::index(i, _size[0]);
 		return _accumulatedOffset + _offset[0] * i;
 	}
 
@@ -906,10 +1051,7 @@ namespace dope {
 			return true;
 		if (_size != r._size)
 			return false;
-		for (SizeType i = static_cast<SizeType>(0); i < _size[0]; ++i)
-			if (at(i) != r.at(i))
-				return false;
-		return true;
+		return internal::findDifference<T, 1>(_array, r._array, _size.data(), _offset.data(), r._offset.data(), false) == _size[0];
 	}
 
 	template < typename T >
@@ -918,4 +1060,25 @@ namespace dope {
 		return !(*this == r);
 	}
 
+	template < typename T >
+	inline bool DopeVector<T, 1>::firstMismatch(const DopeVector<T, 1> &r, Index1 &index) const
+	{
+		if (_size != r._size)
+			throw std::out_of_range("Matrixes do not have same size.");
+		const SizeType position = internal::findDifference<T, 1>(_array, r._array, _size.data(), _offset.data(), r._offset.data(), true);
+		if (position == _size[0])
+			return false;
+		index[0] = position;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+
+
+	static_assert(std::is_trivially_copyable<DopeVector<float, 1>>::value && std::is_trivially_copyable<DopeVector<float, 3>>::value,
+	              "DopeVector must be trivially copyable.");
+	static_assert(std::is_standard_layout<DopeVector<float, 1>>::value && std::is_standard_layout<DopeVector<float, 3>>::value,
+	              "DopeVector must have standard layout.");
+
 }
@@ -0,0 +1,94 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <DopeVector/internal/Equality.hpp>
+#include <DopeVector/internal/Parallel.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		template < typename T >
+		inline SizeType findRowDifference(const T *a, const SizeType aStride, const T *b, const SizeType bStride, const SizeType n)
+		{
+			if (BitwiseComparable<T>::value && aStride == static_cast<SizeType>(1) && bStride == static_cast<SizeType>(1)) {
+				// memcmp pages of elements, then look for the difference in
+				// the page that has one
+				const SizeType page = std::max(static_cast<SizeType>(4096 / sizeof(T)), static_cast<SizeType>(1));
+				for (SizeType start = static_cast<SizeType>(0); start < n; start += page) {
+					const SizeType length = std::min(page, n - start);
+					if (std::memcmp(a + start, b + start, length * sizeof(T)) != 0)
+						for (SizeType i = start; i < start + length; ++i)
+							if (std::memcmp(a + i, b + i, sizeof(T)) != 0)
+								return i;
+				}
+				return n;
+			}
+			for (SizeType i = static_cast<SizeType>(0); i < n; ++i)
+				if (!(a[i * aStride] == b[i * bStride]))
+					return i;
+			return n;
+		}
+
+		template < typename T, SizeType Dimension >
+		inline SizeType findDifference(const T *a, const T *b, const SizeType *size, const SizeType *aOffset, const SizeType *bOffset, const bool first)
+		{
+			SizeType total = static_cast<SizeType>(1);
+			bool dense = true;
+			for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+				if (size[d-1] > static_cast<SizeType>(1) && (aOffset[d-1] != total || bOffset[d-1] != total))
+					dense = false;
+				total *= size[d-1];
+			}
+			if (total == static_cast<SizeType>(0))
+				return total;
+
+			// both dense: a single row of all the elements
+			const SizeType rowLength = dense ? total : size[Dimension-1];
+			const SizeType aStride = dense ? static_cast<SizeType>(1) : aOffset[Dimension-1];
+			const SizeType bStride = dense ? static_cast<SizeType>(1) : bOffset[Dimension-1];
+			// elements compared between two checks of the other threads' results
+			const SizeType piece = static_cast<SizeType>(1) << 16;
+
+			std::atomic<SizeType> found(total);
+			parallel_for(static_cast<SizeType>(0), total, DOPE_PARALLEL_GRAIN, [&](const SizeType from, const SizeType to) {
+				SizeType position = from;
+				while (position < to) {
+					const SizeType best = found.load(std::memory_order_relaxed);
+					if (first ? position >= best : best < total)
+						return;
+					const SizeType column = position % rowLength;
+					SizeType row = position / rowLength;
+					SizeType aBase = column * aStride, bBase = column * bStride;
+					for (SizeType d = Dimension-1; d > static_cast<SizeType>(0) && row > static_cast<SizeType>(0); --d) {
+						const SizeType i = row % size[d-1];
+						row /= size[d-1];
+						aBase += i * aOffset[d-1];
+						bBase += i * bOffset[d-1];
+					}
+					const SizeType count = std::min(std::min(rowLength - column, to - position), piece);
+					const SizeType difference = findRowDifference(a + aBase, aStride, b + bBase, bStride, count);
+					if (difference < count) {
+						SizeType current = found.load(std::memory_order_relaxed);
+						while (position + difference < current && !found.compare_exchange_weak(current, position + difference, std::memory_order_relaxed)) { }
+						return;
+					}
+					position += count;
+				}
+			});
+			return found.load(std::memory_order_relaxed);
+		}
+
+	}
+
+}
@@ -45,11 +45,7 @@ namespace dope {
 		template < class E, typename T, SizeType Dimension, typename Op >
 		inline T StaticArrayUnaryExpression<E, T, Dimension, Op>::operator[](const SizeType i) const
 		{
-			if (!_values[i]) {
-				T t = _op(_e.getAt(i));
-				_values[i] = [t]()->T{ return t; };
-			}
-			return _values[i]();
+			return _op(_e.getAt(i));
 		}
 
 
@@ -65,11 +61,7 @@ namespace dope {
 		template < class El, class Er, typename T, SizeType Dimension, typename Op >
 		inline T StaticArrayBinaryExpression<El, Er, T, Dimension, Op>::operator[](const SizeType i) const
 		{
-			if (!_values[i]) {
-				T t = _op(_el.getAt(i), _er.getAt(i));
-				_values[i] = [t]()->T{ return t; };
-			}
-			return _values[i]();
+			return _op(_el.getAt(i), _er.getAt(i));
 		}
 
 
@@ -8,6 +8,8 @@
 // Author: Maurizio Kovacic
 // email: maurizio.kovacic@gmail.com
 
+#include <algorithm>
+#include <utility>
 #include <DopeVector/Grid.hpp>
 
 namespace dope {
@@ -20,6 +22,7 @@ namespace dope {
 	inline Grid<T, Dimension, Allocator>::Grid(const IndexD &size, const T &default_value)
 	    : _data(size.prod(), default_value)
 	{
+		DOPE_INSTRUMENT_ALLOCATION();
 		DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), size);
 	}
 
@@ -27,6 +30,7 @@ namespace dope {
 	inline Grid<T, Dimension, Allocator>::Grid(const IndexD &size, const IndexD &order, const T &default_value)
 	    : _data(size.prod(), default_value)
 	{
+		DOPE_INSTRUMENT_ALLOCATION();
 		IndexD original_offset;
 		original_offset[Dimension-1] = 1;
 		for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d)
@@ -47,6 +51,7 @@ namespace dope {
 	inline Grid<T, Dimension, Allocator>::Grid(const SizeType size, const T &default_value)
 	    : _data(Index<Dimension>::Constant(size).prod(), default_value)
 	{
+		DOPE_INSTRUMENT_ALLOCATION();
 		DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), Index<Dimension>::Constant(size));
 	}
 
@@ -54,6 +59,7 @@ namespace dope {
 	inline Grid<T, Dimension, Allocator>::Grid(const SizeType size, const IndexD &order, const T &default_value)
 	    : _data(Index<Dimension>::Constant(size).prod(), default_value)
 	{
+		DOPE_INSTRUMENT_ALLOCATION();
 		IndexD original_offset;
 		original_offset[Dimension-1] = 1;
 		for (SizeType d = Dimension-1; d > 0; --d)
@@ -72,11 +78,22 @@ namespace dope {
 
 	template < typename T, SizeType Dimension, class Allocator >
 	inline Grid<T, Dimension, Allocator>::Grid(const Grid &o)
-		: _data(o._data)
+	    : DopeVector<T, Dimension>()
+	    , _data(copyData(o._data))
 	{
 		DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), o.allSizes());
 	}
 
+	template < typename T, SizeType Dimension, class Allocator >
+	inline typename Grid<T, Dimension, Allocator>::Data Grid<T, Dimension, Allocator>::copyData(const Data &data)
+	{
+		DOPE_INSTRUMENT_SCOPE(Operation::GridCopy);
+		DOPE_TRACE_SCOPE("Grid::copy");
+		DOPE_INSTRUMENT_ALLOCATION();
+		DOPE_INSTRUMENT_COPY(data.size(), data.size() * sizeof(T));
+		return Data(data);
+	}
+
 	////////////////////////////////////////////////////////////////////////////
 
 
@@ -159,10 +176,8 @@ namespace dope {
 	{
 		if (&o == this)
 			return true;
-		for (SizeType i = static_cast<SizeType>(0); i < Dimension; ++i)
-			if (DopeVector<T, Dimension>::sizeAt(i) != o.sizeAt(i))
-				return false;
-		return _data == o._data;
+		// compares elements by index, so grids of different orders work too
+		return DopeVector<T, Dimension>::operator==(o);
 	}
 
 	////////////////////////////////////////////////////////////////////////////
@@ -191,6 +206,7 @@ namespace dope {
 	template < typename T, SizeType Dimension, class Allocator >
 	inline void Grid<T, Dimension, Allocator>::resize(const IndexD &size, const T &default_value)
 	{
+		DOPE_TRACE_SCOPE("Grid::resize");
 		_data.resize(size.prod(), default_value);
 		DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), size);
 	}
@@ -198,6 +214,7 @@ namespace dope {
 	template < typename T, SizeType Dimension, class Allocator >
 	inline void Grid<T, Dimension, Allocator>::resize(const IndexD &size, const IndexD &order, const T &default_value)
 	{
+		DOPE_TRACE_SCOPE("Grid::resize");
 		_data.resize(size.prod(), default_value);
 		IndexD original_offset;
 		original_offset[Dimension-1] = 1;
@@ -273,6 +290,8 @@ namespace dope {
 	template < typename T, SizeType Dimension, class Allocator >
 	inline void Grid<T, Dimension, Allocator>::conservativeResize(const IndexD &size, const T &default_value)
 	{
+		DOPE_INSTRUMENT_SCOPE(Operation::ConservativeResize);
+		DOPE_TRACE_SCOPE("Grid::conservativeResize");
 		Grid<T, Dimension, Allocator> newGrid(size, default_value);
 		IndexD oldSize = DopeVector<T, Dimension>::allSizes();
 		IndexD minSize;
@@ -288,6 +307,8 @@ namespace dope {
 	template < typename T, SizeType Dimension, class Allocator >
 	inline void Grid<T, Dimension, Allocator>::conservativeResize(const IndexD &size, const IndexD &order, const T &default_value)
 	{
+		DOPE_INSTRUMENT_SCOPE(Operation::ConservativeResize);
+		DOPE_TRACE_SCOPE("Grid::conservativeResize");
 		IndexD original_offset;
 		original_offset[Dimension-1] = 1;
 		for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d)
@@ -339,39 +360,39 @@ namespace dope {
 	inline Grid<T, Dimension, Allocator> & Grid<T, Dimension, Allocator>::operator=(const Grid &o)
 	{
 		if (&o != this) {
+			DOPE_INSTRUMENT_SCOPE(Operation::GridCopy);
+			DOPE_TRACE_SCOPE("Grid::copy");
+			if (_data.capacity() < o._data.size())
+				DOPE_INSTRUMENT_ALLOCATION();
+			DOPE_INSTRUMENT_COPY(o._data.size(), o._data.size() * sizeof(T));
 			_data = o._data;
 			DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), o.allSizes());
 		}
 		return *this;
 	}
 
-#ifdef DOPE_USE_RTTI
 	template < typename T, SizeType Dimension, class Allocator >
-	inline void Grid<T, Dimension, Allocator>::import(const DopeVector<T, Dimension> &o)
+	inline void Grid<T, Dimension, Allocator>::import(const Grid &o)
 	{
 		if (&o == this)
 			return;
-
-		try {
-			const Grid<T, Dimension, Allocator> &oo = dynamic_cast<const Grid<T, Dimension, Allocator> &>(o);
-			IndexD size = DopeVector<T, Dimension>::allSizes();
-			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
-				if (size[d] != oo.sizeAt(d))
-					throw std::out_of_range("Matrixes do not have same size.");
-			_data = oo._data;
-			DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), size); // could be unuseful
-		} catch(std::bad_cast &bc) {
+		if (DopeVector<T, Dimension>::allSizes() != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		DOPE_INSTRUMENT_SCOPE(Operation::Import);
+		DOPE_TRACE_SCOPE("Grid::import");
+		if (DopeVector<T, Dimension>::allOffsets() == o.allOffsets()) {
+			DOPE_INSTRUMENT_COPY(_data.size(), _data.size() * sizeof(T));
+			std::copy(o._data.begin(), o._data.end(), _data.begin());
+		} else
 			DopeVector<T, Dimension>::import(o);
-		}
 	}
-#endif
 
 	template < typename T, SizeType Dimension, class Allocator >
 	inline void Grid<T, Dimension, Allocator>::swap(Grid &o)
 	{
+		// buffers are exchanged as they are, so the views follow them
 		_data.swap(o._data);
-		IndexD size = DopeVector<T, Dimension>::allSizes();
-		DopeVector<T, Dimension>::reset(_data.data(), static_cast<SizeType>(0), size);
+		std::swap(static_cast<DopeVector<T, Dimension> &>(*this), static_cast<DopeVector<T, Dimension> &>(o));
 	}
 
 	////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,341 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <DopeVector/Hash.hpp>
+#include <DopeVector/Tracing.hpp>
+#include <DopeVector/internal/Parallel.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension >
+	inline std::uint64_t contentHash(const DopeVector<T, Dimension> &view, const std::uint64_t seed)
+	{
+		return contentHash128(view, seed).low;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline Hash128 contentHash128(const DopeVector<T, Dimension> &view, const std::uint64_t seed)
+	{
+		return ContentHash<T, Dimension>(view, seed).value128();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension >
+	inline ContentHash<T, Dimension>::ContentHash(const DopeVector<T, Dimension> &view, const std::uint64_t seed)
+	    : _view(view)
+	    , _seed(seed)
+	    , _leaves((view.size() + internal::hashLeafElements<T>() - 1) / internal::hashLeafElements<T>())
+	    , _value()
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be hashed by their bytes.");
+		update();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	// UPDATE
+	////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension >
+	inline void ContentHash<T, Dimension>::update()
+	{
+		DOPE_TRACE_SCOPE("ContentHash::update");
+		const SizeType grain = std::max(DOPE_PARALLEL_GRAIN / internal::hashLeafElements<T>(), static_cast<SizeType>(1));
+		internal::parallel_for(static_cast<SizeType>(0), static_cast<SizeType>(_leaves.size()), grain, [this](const SizeType from, const SizeType to) {
+			for (SizeType l = from; l < to; ++l)
+				_leaves[l] = internal::hashLeaf(_view, l, _seed);
+		});
+		_value = internal::combineLeaves<T, Dimension>(_view.allSizes(), _leaves, _seed);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline void ContentHash<T, Dimension>::update(const IndexD &start, const IndexD &size)
+	{
+		const IndexD &all = _view.allSizes();
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			if (start[d] > all[d] || size[d] > all[d] - start[d])
+				internal::throw_window_out_of_range(start[d], size[d], all[d]);
+		SizeType rows = static_cast<SizeType>(1);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			rows *= size[d];
+		if (rows == static_cast<SizeType>(0))
+			return;
+		rows /= size[Dimension-1];
+
+		DOPE_TRACE_SCOPE("ContentHash::update");
+		// mark the leaves overlapped by each row of the block along the last
+		// dimension
+		const SizeType leafElements = internal::hashLeafElements<T>();
+		std::vector<char> dirty(_leaves.size(), 0);
+		for (SizeType r = static_cast<SizeType>(0); r < rows; ++r) {
+			SizeType position = static_cast<SizeType>(0), rest = r, stride = static_cast<SizeType>(1);
+			for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+				SizeType i = start[d-1];
+				if (d < Dimension) {
+					i += rest % size[d-1];
+					rest /= size[d-1];
+				}
+				position += i * stride;
+				stride *= all[d-1];
+			}
+			const SizeType last = (position + size[Dimension-1] - 1) / leafElements;
+			for (SizeType l = position / leafElements; l <= last; ++l)
+				dirty[l] = 1;
+		}
+		std::vector<SizeType> changed;
+		for (SizeType l = static_cast<SizeType>(0); l < static_cast<SizeType>(dirty.size()); ++l)
+			if (dirty[l])
+				changed.push_back(l);
+
+		const SizeType grain = std::max(DOPE_PARALLEL_GRAIN / leafElements, static_cast<SizeType>(1));
+		internal::parallel_for(static_cast<SizeType>(0), static_cast<SizeType>(changed.size()), grain, [&](const SizeType from, const SizeType to) {
+			for (SizeType c = from; c < to; ++c)
+				_leaves[changed[c]] = internal::hashLeaf(_view, changed[c], _seed);
+		});
+		_value = internal::combineLeaves<T, Dimension>(all, _leaves, _seed);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension >
+	inline std::uint64_t ContentHash<T, Dimension>::value() const
+	{
+		return _value.low;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline const Hash128 & ContentHash<T, Dimension>::value128() const
+	{
+		return _value;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType ContentHash<T, Dimension>::leafCount() const
+	{
+		return static_cast<SizeType>(_leaves.size());
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+
+
+	namespace internal {
+
+		namespace hash_constants {
+			constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ULL;
+			constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+			constexpr std::uint64_t P3 = 0x165667B19E3779F9ULL;
+			constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+			constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ULL;
+		}
+
+		inline std::uint64_t hashRotate(const std::uint64_t x, const unsigned r)
+		{
+			return (x << r) | (x >> (64 - r));
+		}
+
+		inline std::uint64_t hashRound(std::uint64_t acc, const std::uint64_t input)
+		{
+			acc += input * hash_constants::P2;
+			return hashRotate(acc, 31) * hash_constants::P1;
+		}
+
+		inline std::uint64_t hashMerge(const std::uint64_t acc, const std::uint64_t lane)
+		{
+			return (acc ^ hashRound(0, lane)) * hash_constants::P1 + hash_constants::P4;
+		}
+
+		inline std::uint64_t hashAvalanche(std::uint64_t h)
+		{
+			h ^= h >> 33;
+			h *= hash_constants::P2;
+			h ^= h >> 29;
+			h *= hash_constants::P3;
+			return h ^ (h >> 32);
+		}
+
+		template < typename U >
+		inline U hashRead(const unsigned char *p)
+		{
+			U u;
+			std::memcpy(&u, p, sizeof(U));
+			return u;
+		}
+
+		inline HashState::HashState(const std::uint64_t seed)
+		    : _lanes{seed + hash_constants::P1 + hash_constants::P2, seed + hash_constants::P2, seed, seed - hash_constants::P1}
+		    , _seed(seed)
+		    , _length(0)
+		    , _buffered(0)
+		{ }
+
+		inline void HashState::update(const void *data, SizeType bytes)
+		{
+			const unsigned char *p = static_cast<const unsigned char *>(data);
+			_length += bytes;
+			if (_buffered + bytes < static_cast<SizeType>(32)) {
+				std::memcpy(_buffer + _buffered, p, bytes);
+				_buffered += bytes;
+				return;
+			}
+			std::uint64_t v0 = _lanes[0], v1 = _lanes[1], v2 = _lanes[2], v3 = _lanes[3];
+			if (_buffered > static_cast<SizeType>(0)) {
+				const SizeType fill = static_cast<SizeType>(32) - _buffered;
+				std::memcpy(_buffer + _buffered, p, fill);
+				p += fill;
+				bytes -= fill;
+				_buffered = 0;
+				v0 = hashRound(v0, hashRead<std::uint64_t>(_buffer));
+				v1 = hashRound(v1, hashRead<std::uint64_t>(_buffer + 8));
+				v2 = hashRound(v2, hashRead<std::uint64_t>(_buffer + 16));
+				v3 = hashRound(v3, hashRead<std::uint64_t>(_buffer + 24));
+			}
+			// the four lanes are independent, so their rounds overlap in the
+			// pipeline
+			for (; bytes >= static_cast<SizeType>(32); p += 32, bytes -= 32) {
+				v0 = hashRound(v0, hashRead<std::uint64_t>(p));
+				v1 = hashRound(v1, hashRead<std::uint64_t>(p + 8));
+				v2 = hashRound(v2, hashRead<std::uint64_t>(p + 16));
+				v3 = hashRound(v3, hashRead<std::uint64_t>(p + 24));
+			}
+			_lanes[0] = v0; _lanes[1] = v1; _lanes[2] = v2; _lanes[3] = v3;
+			std::memcpy(_buffer, p, bytes);
+			_buffered = bytes;
+		}
+
+		inline Hash128 HashState::digest() const
+		{
+			using namespace hash_constants;
+			std::uint64_t h, g;
+			if (_length >= 32) {
+				h = hashRotate(_lanes[0], 1) + hashRotate(_lanes[1], 7) + hashRotate(_lanes[2], 12) + hashRotate(_lanes[3], 18);
+				g = hashRotate(_lanes[0], 18) + hashRotate(_lanes[1], 12) + hashRotate(_lanes[2], 7) + hashRotate(_lanes[3], 1);
+				for (SizeType l = static_cast<SizeType>(0); l < static_cast<SizeType>(4); ++l) {
+					h = hashMerge(h, _lanes[l]);
+					g = hashMerge(g, _lanes[3 - l]);
+				}
+			} else {
+				h = _seed + P5;
+				g = hashRotate(_seed, 32) + P3;
+			}
+			h += _length;
+			g ^= _length * P1;
+
+			const unsigned char *p = _buffer;
+			SizeType bytes = _buffered;
+			for (; bytes >= static_cast<SizeType>(8); p += 8, bytes -= 8) {
+				const std::uint64_t k = hashRead<std::uint64_t>(p);
+				h = hashRotate(h ^ hashRound(0, k), 27) * P1 + P4;
+				g = hashRotate(g ^ hashRound(P3, k), 29) * P2 + P3;
+			}
+			if (bytes >= static_cast<SizeType>(4)) {
+				const std::uint64_t k = hashRead<std::uint32_t>(p);
+				h = hashRotate(h ^ (k * P1), 23) * P2 + P3;
+				g = hashRotate(g ^ (k * P2), 19) * P1 + P4;
+				p += 4;
+				bytes -= 4;
+			}
+			for (; bytes > static_cast<SizeType>(0); ++p, --bytes) {
+				h = hashRotate(h ^ (*p * P5), 11) * P1;
+				g = hashRotate(g ^ (*p * P1), 13) * P2;
+			}
+			return Hash128{hashAvalanche(h), hashAvalanche(g ^ (h >> 17))};
+		}
+
+		template < typename T >
+		constexpr SizeType hashLeafElements()
+		{
+			return static_cast<SizeType>(DOPE_HASH_LEAF_BYTES) / sizeof(T) > static_cast<SizeType>(0) ? static_cast<SizeType>(DOPE_HASH_LEAF_BYTES) / sizeof(T) : static_cast<SizeType>(1);
+		}
+
+		template < typename T, SizeType Dimension >
+		inline Hash128 hashLeaf(const DopeVector<T, Dimension> &view, const SizeType leaf, const std::uint64_t seed)
+		{
+			const SizeType *size = view.allSizes().data();
+			const SizeType *offset = view.allOffsets().data();
+			const T *origin = &*view.begin();
+
+			const SizeType total = view.size();
+			const bool dense = view.isContiguous();
+			const SizeType rowLength = dense ? total : size[Dimension-1];
+			const SizeType stride = dense ? static_cast<SizeType>(1) : offset[Dimension-1];
+			const SizeType end = std::min(total, (leaf + 1) * hashLeafElements<T>());
+
+			HashState state(seed);
+			// small strided elements are gathered in a buffer before hashing
+			unsigned char buffer[1024];
+			const SizeType gather = static_cast<SizeType>(sizeof(buffer) / sizeof(T));
+			for (SizeType position = leaf * hashLeafElements<T>(); position < end; ) {
+				const SizeType column = position % rowLength;
+				SizeType row = position / rowLength;
+				SizeType base = column * stride;
+				for (SizeType d = Dimension-1; d > static_cast<SizeType>(0) && row > static_cast<SizeType>(0); --d) {
+					base += (row % size[d-1]) * offset[d-1];
+					row /= size[d-1];
+				}
+				const SizeType count = std::min(rowLength - column, end - position);
+				if (stride == static_cast<SizeType>(1)) {
+					state.update(origin + base, count * sizeof(T));
+				} else if (gather < static_cast<SizeType>(16)) {
+					for (SizeType i = static_cast<SizeType>(0); i < count; ++i)
+						state.update(origin + base + i * stride, sizeof(T));
+				} else {
+					for (SizeType done = static_cast<SizeType>(0); done < count; ) {
+						const SizeType n = std::min(gather, count - done);
+						for (SizeType i = static_cast<SizeType>(0); i < n; ++i)
+							std::memcpy(buffer + i * sizeof(T), origin + base + (done + i) * stride, sizeof(T));
+						state.update(buffer, n * sizeof(T));
+						done += n;
+					}
+				}
+				position += count;
+			}
+			return state.digest();
+		}
+
+		template < typename T, SizeType Dimension >
+		inline Hash128 combineLeaves(const Index<Dimension> &size, const std::vector<Hash128> &leaves, const std::uint64_t seed)
+		{
+			HashState state(seed ^ hash_constants::P4);
+			const std::uint64_t header[2] = {static_cast<std::uint64_t>(Dimension), static_cast<std::uint64_t>(sizeof(T))};
+			state.update(header, sizeof(header));
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				const std::uint64_t s = static_cast<std::uint64_t>(size[d]);
+				state.update(&s, sizeof(s));
+			}
+			for (const Hash128 &leaf : leaves) {
+				const std::uint64_t words[2] = {leaf.low, leaf.high};
+				state.update(words, sizeof(words));
+			}
+			return state.digest();
+		}
+
+	}
+
+}
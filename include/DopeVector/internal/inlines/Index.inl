@@ -9,6 +9,7 @@
 // email: maurizio.kovacic@gmail.com
 
 #include <DopeVector/Index.hpp>
+#include <DopeVector/internal/Divider.hpp>
 #include <stdexcept>
 #include <algorithm>
 
@@ -213,4 +214,79 @@ namespace dope {
 		return result;
 	}
 
+	template < SizeType Dimension >
+	inline void to_positions(const Index<Dimension> *indices, const SizeType count, const Index<Dimension> &range, SizeType *positions)
+	{
+		Index<Dimension> offset;
+		SizeType dimProd = static_cast<SizeType>(1);
+		for(SizeType D = Dimension; D > static_cast<SizeType>(0); --D) {
+			SizeType d = D - static_cast<SizeType>(1);
+			offset[d] = dimProd;
+			dimProd *= range[d];
+		}
+		to_positionsFromOffset(indices, count, offset, positions);
+	}
+
+	template < SizeType Dimension >
+	inline void to_positionsFromOffset(const Index<Dimension> *indices, const SizeType count, const Index<Dimension> &offset, SizeType *positions)
+	{
+		// local copy, which the output can not alias
+		SizeType jump[Dimension];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			jump[d] = offset[d];
+		for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+			SizeType position = static_cast<SizeType>(0);
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+				position += indices[n][d] * jump[d];
+			positions[n] = position;
+		}
+	}
+
+	template < SizeType Dimension >
+	inline void to_indices(const SizeType *positions, const SizeType count, const Index<Dimension> &range, Index<Dimension> *indices)
+	{
+		SizeType size[Dimension];
+		internal::Divider bySize[Dimension];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			size[d] = range[d];
+			bySize[d] = internal::Divider(size[d]);
+		}
+		for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+			SizeType i = positions[n];
+			for(SizeType D = Dimension; D > static_cast<SizeType>(0); --D) {
+				SizeType d = D - static_cast<SizeType>(1);
+				const SizeType next = bySize[d].divide(i);
+				indices[n][d] = i - next * size[d];
+				i = next;
+			}
+		}
+	}
+
+	template < SizeType Dimension >
+	inline void to_indicesFromOffset(const SizeType *positions, const SizeType count, const Index<Dimension> &offset, Index<Dimension> *indices)
+	{
+		Index<Dimension> order;
+		for (SizeType i = static_cast<SizeType>(0); i < Dimension; ++i)
+			order[i] = i;
+		std::sort(order.begin(), order.end(), [&offset](const SizeType &l, const SizeType &r)->bool{
+			return offset[l] < offset[r];
+		});
+		// dimensions and offsets by decreasing offset
+		SizeType dimension[Dimension], jump[Dimension];
+		internal::Divider byJump[Dimension];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			dimension[d] = order[Dimension-1-d];
+			jump[d] = offset[dimension[d]];
+			byJump[d] = internal::Divider(jump[d]);
+		}
+		for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+			SizeType linear_position = positions[n];
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				const SizeType i = byJump[d].divide(linear_position);
+				indices[n][dimension[d]] = i;
+				linear_position -= i * jump[d];
+			}
+		}
+	}
+
 }
@@ -0,0 +1,101 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <chrono>
+#include <DopeVector/Instrumentation.hpp>
+
+namespace dope {
+
+	constexpr bool Instrumentation::enabled()
+	{
+#ifdef DOPE_USE_INSTRUMENTATION
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	inline Instrumentation::Snapshot Instrumentation::snapshot()
+	{
+		return internal::instrumentationState().counters;
+	}
+
+	inline OperationCounters Instrumentation::counters(const Operation op)
+	{
+		return internal::instrumentationState().counters[static_cast<SizeType>(op)];
+	}
+
+	inline void Instrumentation::reset()
+	{
+		internal::instrumentationState().counters = Snapshot();
+	}
+
+	inline const char * Instrumentation::name(const Operation op)
+	{
+		switch (op) {
+		case Operation::Import:             return "import";
+		case Operation::SafeImport:         return "safe_import";
+		case Operation::GridCopy:           return "grid_copy";
+		case Operation::ConservativeResize: return "conservative_resize";
+		default:                            return "unknown";
+		}
+	}
+
+
+
+	namespace internal {
+
+		inline InstrumentationState & instrumentationState()
+		{
+			static thread_local InstrumentationState state = InstrumentationState();
+			return state;
+		}
+
+		inline InstrumentationScope::InstrumentationScope(const Operation op)
+		    : _start(0)
+		{
+			InstrumentationState &state = instrumentationState();
+			if (state.depth++ == static_cast<SizeType>(0)) {
+				state.current = op;
+				_start = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+		}
+
+		inline InstrumentationScope::~InstrumentationScope()
+		{
+			InstrumentationState &state = instrumentationState();
+			if (--state.depth == static_cast<SizeType>(0)) {
+				const std::int64_t end = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+				OperationCounters &counters = state.counters[static_cast<SizeType>(state.current)];
+				++counters.calls;
+				counters.nanoseconds += static_cast<std::uint64_t>(end - _start);
+			}
+		}
+
+		inline void instrumentCopy(const SizeType elements, const SizeType bytes)
+		{
+			InstrumentationState &state = instrumentationState();
+			if (state.depth > static_cast<SizeType>(0)) {
+				OperationCounters &counters = state.counters[static_cast<SizeType>(state.current)];
+				counters.elements += elements;
+				counters.bytes += bytes;
+			}
+		}
+
+		inline void instrumentAllocation()
+		{
+			InstrumentationState &state = instrumentationState();
+			if (state.depth > static_cast<SizeType>(0))
+				++state.counters[static_cast<SizeType>(state.current)].allocations;
+		}
+
+	}
+
+}
@@ -109,17 +109,15 @@ namespace dope {
 		template < typename T, SizeType Dimension, bool Const >
 		inline typename Iterator<T, Dimension, Const>::reference Iterator<T, Dimension, Const>::operator*() const
 		{
-			if (!_valid)
-				throw std::range_error("Iterator not valid.");
-			return const_cast<reference>(_data.get().at(_currentIndex));
+			Bounds<BoundsCheckPolicy<T, Dimension>::value>::iterator(_valid);
+			return const_cast<reference>(_data.get().element(_currentIndex));
 		}
 
 		template < typename T, SizeType Dimension, bool Const >
 		inline typename Iterator<T, Dimension, Const>::pointer Iterator<T, Dimension, Const>::operator->() const
 		{
-			if (!_valid)
-				throw std::range_error("Iterator not valid.");
-			return const_cast<pointer>(&_data.get().at(_currentIndex));
+			Bounds<BoundsCheckPolicy<T, Dimension>::value>::iterator(_valid);
+			return const_cast<pointer>(&_data.get().element(_currentIndex));
 		}
 		template < typename T, SizeType Dimension, bool Const >
 		inline typename Iterator<T, Dimension, Const>::reference Iterator<T, Dimension, Const>::operator[](const SizeType n) const
@@ -144,7 +142,18 @@ namespace dope {
 		template < typename T, SizeType Dimension, bool Const >
 		inline typename Iterator<T, Dimension, Const>::self_type& Iterator<T, Dimension, Const>::operator++()
 		{
-			return *this += static_cast<SizeType>(1);
+			if (!_valid)
+				return *this;
+			// carry by comparison, without dividing by the sizes
+			const IndexD &size = _data.get().allSizes();
+			for (SizeType D = Dimension; D > static_cast<SizeType>(0); --D) {
+				SizeType d = D - static_cast<SizeType>(1);
+				if (++_currentIndex[d] < size[d])
+					return *this;
+				_currentIndex[d] = static_cast<SizeType>(0);
+			}
+			_valid = false;
+			return *this;
 		}
 
 		template < typename T, SizeType Dimension, bool Const >
@@ -219,7 +228,21 @@ namespace dope {
 
 		template < typename T, SizeType Dimension, bool Const >
 		inline typename Iterator<T, Dimension, Const>::self_type & Iterator<T, Dimension, Const>::operator--() {
-			return *this -= static_cast<SizeType>(1);
+			if (!_valid)
+				return *this;
+			// borrow by comparison, without dividing by the sizes
+			const IndexD &size = _data.get().allSizes();
+			for (SizeType D = Dimension; D > static_cast<SizeType>(0); --D) {
+				SizeType d = D - static_cast<SizeType>(1);
+				if (_currentIndex[d] > static_cast<SizeType>(0)) {
+					--_currentIndex[d];
+					return *this;
+				}
+				_currentIndex[d] = size[d] - static_cast<SizeType>(1);
+			}
+			_currentIndex = IndexD::Zero();
+			_valid = false;
+			return *this;
 		}
 
 		template < typename T, SizeType Dimension, bool Const >
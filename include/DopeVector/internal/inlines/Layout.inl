@@ -0,0 +1,179 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <DopeVector/Layout.hpp>
+
+namespace dope {
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < SizeType Dimension >
+	inline Layout<Dimension>::Layout()
+	    : Layout(IndexD::Zero())
+	{ }
+
+	template < SizeType Dimension >
+	inline Layout<Dimension>::Layout(const IndexD &size)
+	    : Layout(size, denseOffsets(size))
+	{ }
+
+	template < SizeType Dimension >
+	inline Layout<Dimension>::Layout(const IndexD &size, const IndexD &offset)
+	    : _size(size)
+	    , _offset(offset)
+	{
+		// same order as to_indexFromOffset, ties included
+		IndexD increasing;
+		for (SizeType i = static_cast<SizeType>(0); i < Dimension; ++i)
+			increasing[i] = i;
+		std::sort(increasing.begin(), increasing.end(), [&offset](const SizeType &l, const SizeType &r)->bool{
+			return offset[l] < offset[r];
+		});
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			_order[d] = increasing[Dimension-1-d];
+
+		_dense = true;
+		SizeType expected = static_cast<SizeType>(1);
+		for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+			_contiguous[d-1] = size[d-1] <= static_cast<SizeType>(1) || offset[d-1] == expected;
+			_dense = _dense && _contiguous[d-1];
+			expected *= size[d-1];
+		}
+
+		// empty dimensions, and offsets of dimensions with one element, may
+		// be 0: they are never divided by
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			_bySize[d] = internal::Divider(std::max(size[d], static_cast<SizeType>(1)));
+			_byOffset[d] = internal::Divider(std::max(offset[_order[d]], static_cast<SizeType>(1)));
+		}
+	}
+
+	template < SizeType Dimension >
+	inline typename Layout<Dimension>::IndexD Layout<Dimension>::denseOffsets(const IndexD &size)
+	{
+		IndexD offset;
+		SizeType dimProd = static_cast<SizeType>(1);
+		for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+			offset[d-1] = dimProd;
+			dimProd *= size[d-1];
+		}
+		return offset;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERSIONS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < SizeType Dimension >
+	inline SizeType Layout<Dimension>::to_position(const IndexD &index) const
+	{
+		return dope::to_position(index, _size);
+	}
+
+	template < SizeType Dimension >
+	inline typename Layout<Dimension>::IndexD Layout<Dimension>::to_index(const SizeType position) const
+	{
+		IndexD index;
+		SizeType rest = position;
+		for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+			const SizeType next = _bySize[d-1].divide(rest);
+			index[d-1] = rest - next * _size[d-1];
+			rest = next;
+		}
+		return index;
+	}
+
+	template < SizeType Dimension >
+	inline SizeType Layout<Dimension>::to_offset(const IndexD &index) const
+	{
+		return to_positionFromOffset(index, _offset);
+	}
+
+	template < SizeType Dimension >
+	inline SizeType Layout<Dimension>::to_offset(const SizeType position) const
+	{
+		if (_dense)
+			return position;
+		SizeType rest = position, offset = static_cast<SizeType>(0);
+		for (SizeType d = Dimension; d > static_cast<SizeType>(0); --d) {
+			const SizeType next = _bySize[d-1].divide(rest);
+			offset += (rest - next * _size[d-1]) * _offset[d-1];
+			rest = next;
+		}
+		return offset;
+	}
+
+	template < SizeType Dimension >
+	inline typename Layout<Dimension>::IndexD Layout<Dimension>::to_indexFromOffset(const SizeType offset) const
+	{
+		IndexD index;
+		SizeType rest = offset;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			const SizeType i = _byOffset[d].divide(rest);
+			index[_order[d]] = i;
+			rest -= i * _offset[_order[d]];
+		}
+		return index;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < SizeType Dimension >
+	inline const typename Layout<Dimension>::IndexD & Layout<Dimension>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < SizeType Dimension >
+	inline const typename Layout<Dimension>::IndexD & Layout<Dimension>::allOffsets() const
+	{
+		return _offset;
+	}
+
+	template < SizeType Dimension >
+	inline SizeType Layout<Dimension>::size() const
+	{
+		return _size.prod();
+	}
+
+	template < SizeType Dimension >
+	inline const typename Layout<Dimension>::IndexD & Layout<Dimension>::order() const
+	{
+		return _order;
+	}
+
+	template < SizeType Dimension >
+	inline bool Layout<Dimension>::isContiguous(const SizeType d) const
+	{
+		return _contiguous[d];
+	}
+
+	template < SizeType Dimension >
+	inline bool Layout<Dimension>::isContiguous() const
+	{
+		return _dense;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,331 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#if defined(__BMI2__)
+	#include <immintrin.h>
+#endif
+#include <DopeVector/MortonGrid.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		inline std::uint64_t deposit_bits(const std::uint64_t value, const std::uint64_t mask)
+		{
+#if defined(__BMI2__)
+			return _pdep_u64(value, mask);
+#else
+			std::uint64_t result = 0, m = mask;
+			for (std::uint64_t bit = 1; m != 0; bit <<= 1) {
+				if (value & bit)
+					result |= m & (~m + 1);
+				m &= m - 1;
+			}
+			return result;
+#endif
+		}
+
+		inline std::uint64_t extract_bits(const std::uint64_t value, const std::uint64_t mask)
+		{
+#if defined(__BMI2__)
+			return _pext_u64(value, mask);
+#else
+			std::uint64_t result = 0, m = mask;
+			for (std::uint64_t bit = 1; m != 0; bit <<= 1) {
+				if (value & m & (~m + 1))
+					result |= bit;
+				m &= m - 1;
+			}
+			return result;
+#endif
+		}
+
+		/**
+		 * @brief Returns the code following code among the ones whose bits
+		 *        are all in mask, i.e. increments the index component that
+		 *        mask is assigned to.
+		 */
+		inline std::uint64_t masked_increment(const std::uint64_t code, const std::uint64_t mask)
+		{
+			return ((code | ~mask) + 1) & mask;
+		}
+
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline MortonGrid<T, Dimension, Allocator>::MortonGrid()
+	    : _size(IndexD::Zero())
+	{
+		_masks.fill(0);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline MortonGrid<T, Dimension, Allocator>::MortonGrid(const IndexD &size, const T &default_value)
+	    : MortonGrid()
+	{
+		resize(size, default_value);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline MortonGrid<T, Dimension, Allocator>::MortonGrid(const DopeVector<T, Dimension> &o)
+	    : MortonGrid(o.allSizes())
+	{
+		import(o);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ENCODING
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SizeType MortonGrid<T, Dimension, Allocator>::encode(const IndexD &i) const
+	{
+		std::uint64_t code = 0;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			code |= internal::deposit_bits(i[d], _masks[d]);
+		return static_cast<SizeType>(code);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline typename MortonGrid<T, Dimension, Allocator>::IndexD MortonGrid<T, Dimension, Allocator>::decode(const SizeType code) const
+	{
+		IndexD i;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			i[d] = static_cast<SizeType>(internal::extract_bits(code, _masks[d]));
+		return i;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ACCESS METHODS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const T & MortonGrid<T, Dimension, Allocator>::at(const IndexD &i) const
+	{
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			Check::index(i[d], _size[d]);
+		return _data[encode(i)];
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline T & MortonGrid<T, Dimension, Allocator>::at(const IndexD &i)
+	{
+		return const_cast<T &>(static_cast<const MortonGrid &>(*this).at(i));
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const T & MortonGrid<T, Dimension, Allocator>::operator[](const IndexD &i) const
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline T & MortonGrid<T, Dimension, Allocator>::operator[](const IndexD &i)
+	{
+		return at(i);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERSIONS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator > template < class F >
+	inline void MortonGrid<T, Dimension, Allocator>::forEachRow(const DopeVector<T, Dimension> &o, F f) const
+	{
+		if (_data.empty())
+			return;
+		// walk the rows in row-major order, incrementing the Morton code of
+		// the outer index components instead of encoding them from scratch
+		IndexD i = IndexD::Zero();
+		std::array<std::uint64_t, Dimension> part;
+		part.fill(0);
+		const SizeType rows = size() / _size[Dimension-1];
+		for (SizeType r = static_cast<SizeType>(0); r < rows; ++r) {
+			std::uint64_t code = 0;
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension-1; ++d)
+				code |= part[d];
+			f(const_cast<T *>(&o.at(i)), o.offsetAt(Dimension-1), code);
+			for (SizeType D = Dimension-1; D > static_cast<SizeType>(0); --D) {
+				SizeType d = D - static_cast<SizeType>(1);
+				part[d] = internal::masked_increment(part[d], _masks[d]);
+				if (++i[d] < _size[d])
+					break;
+				i[d] = static_cast<SizeType>(0);
+				part[d] = 0;
+			}
+		}
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void MortonGrid<T, Dimension, Allocator>::import(const DopeVector<T, Dimension> &o)
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		const std::uint64_t mask = _masks[Dimension-1];
+		const SizeType length = _size[Dimension-1];
+		T *data = _data.data();
+		forEachRow(o, [data, mask, length](const T *row, const SizeType stride, const std::uint64_t code) {
+			std::uint64_t part = 0;
+			for (SizeType j = static_cast<SizeType>(0); j < length; ++j, row += stride) {
+				data[code | part] = *row;
+				part = internal::masked_increment(part, mask);
+			}
+		});
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void MortonGrid<T, Dimension, Allocator>::exportTo(DopeVector<T, Dimension> &o) const
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		const std::uint64_t mask = _masks[Dimension-1];
+		const SizeType length = _size[Dimension-1];
+		const T *data = _data.data();
+		forEachRow(o, [data, mask, length](T *row, const SizeType stride, const std::uint64_t code) {
+			std::uint64_t part = 0;
+			for (SizeType j = static_cast<SizeType>(0); j < length; ++j, row += stride) {
+				*row = data[code | part];
+				part = internal::masked_increment(part, mask);
+			}
+		});
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void MortonGrid<T, Dimension, Allocator>::to_grid(Grid<T, Dimension, Allocator> &g) const
+	{
+		g.resize(_size);
+		exportTo(g);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const typename MortonGrid<T, Dimension, Allocator>::IndexD & MortonGrid<T, Dimension, Allocator>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SizeType MortonGrid<T, Dimension, Allocator>::sizeAt(const SizeType d) const
+	{
+		if (d >= Dimension) {
+			std::stringstream stream;
+			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		return _size[d];
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SizeType MortonGrid<T, Dimension, Allocator>::size() const
+	{
+		return _data.size();
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline bool MortonGrid<T, Dimension, Allocator>::empty() const
+	{
+		return _data.empty();
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const T * MortonGrid<T, Dimension, Allocator>::data() const
+	{
+		return _data.data();
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline T * MortonGrid<T, Dimension, Allocator>::data()
+	{
+		return _data.data();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RESET
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void MortonGrid<T, Dimension, Allocator>::clear()
+	{
+		_data.clear();
+		_size = IndexD::Zero();
+		_masks.fill(0);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void MortonGrid<T, Dimension, Allocator>::resize(const IndexD &size, const T &default_value)
+	{
+		IndexD bits = IndexD::Zero();
+		SizeType totalBits = static_cast<SizeType>(0);
+		bool empty = false;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			if (size[d] == static_cast<SizeType>(0)) {
+				empty = true;
+				continue;
+			}
+			if ((size[d] & (size[d] - 1)) != static_cast<SizeType>(0)) {
+				std::stringstream stream;
+				stream << "Size " << size[d] << " is not a power of two.";
+				throw std::invalid_argument(stream.str());
+			}
+			while ((static_cast<SizeType>(1) << bits[d]) < size[d])
+				++bits[d];
+			totalBits += bits[d];
+		}
+		if (totalBits >= static_cast<SizeType>(64) || totalBits >= static_cast<SizeType>(sizeof(SizeType) * 8))
+			throw std::invalid_argument("Morton codes do not fit in SizeType.");
+
+		// interleave one bit per dimension at a time, the last dimension
+		// taking the least significant bit as in row-major order
+		_masks.fill(0);
+		SizeType position = static_cast<SizeType>(0);
+		for (SizeType level = static_cast<SizeType>(0); position < totalBits; ++level)
+			for (SizeType D = Dimension; D > static_cast<SizeType>(0); --D) {
+				SizeType d = D - static_cast<SizeType>(1);
+				if (level < bits[d])
+					_masks[d] |= static_cast<std::uint64_t>(1) << position++;
+			}
+
+		_size = size;
+		if (empty)
+			_data.clear();
+		else
+			_data.assign(static_cast<SizeType>(1) << totalBits, default_value);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <DopeVector/internal/Parallel.hpp>
+#include <DopeVector/Tracing.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		inline SizeType parallelThreads(const SizeType count, const SizeType grain)
+		{
+			SizeType threads = DOPE_PARALLEL_THREADS;
+			if (threads == static_cast<SizeType>(0))
+				threads = std::max(static_cast<SizeType>(std::thread::hardware_concurrency()), static_cast<SizeType>(1));
+			return std::max(std::min(threads, count / std::max(grain, static_cast<SizeType>(1))), static_cast<SizeType>(1));
+		}
+
+		template < class F >
+		inline void parallel_for(const SizeType begin, const SizeType end, const SizeType grain, F f)
+		{
+			if (end <= begin)
+				return;
+			const SizeType count = end - begin;
+			const SizeType threads = parallelThreads(count, grain);
+			if (threads == static_cast<SizeType>(1)) {
+				f(begin, end);
+				return;
+			}
+
+			DOPE_TRACE_SCOPE("parallel_for");
+			std::exception_ptr error;
+			std::mutex errorMutex;
+			auto task = [&](const SizeType from, const SizeType to) {
+				DOPE_TRACE_SCOPE("parallel_for::task");
+				try {
+					f(from, to);
+				} catch (...) {
+					std::lock_guard<std::mutex> lock(errorMutex);
+					if (!error)
+						error = std::current_exception();
+				}
+			};
+
+			std::vector<std::thread> workers;
+			workers.reserve(threads - 1);
+			for (SizeType t = static_cast<SizeType>(0); t + 1 < threads; ++t) {
+				const SizeType from = begin + count * t / threads, to = begin + count * (t + 1) / threads;
+				try {
+					workers.emplace_back(task, from, to);
+				} catch (const std::system_error &) {
+					task(from, to);     // no thread available: run the chunk here
+				}
+			}
+			task(begin + count * (threads - 1) / threads, end);
+			for (std::thread &w : workers)
+				w.join();
+			if (error)
+				std::rethrow_exception(error);
+		}
+
+	}
+
+}
@@ -0,0 +1,220 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <DopeVector/Pyramid.hpp>
+#include <DopeVector/internal/Parallel.hpp>
+
+namespace dope {
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline Pyramid<T, Dimension, Allocator>::Pyramid()
+	{ }
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline Pyramid<T, Dimension, Allocator>::Pyramid(const DopeVector<T, Dimension> &finest, const SizeType levels)
+	    : Pyramid(finest, Kernel(), levels)
+	{ }
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline Pyramid<T, Dimension, Allocator>::Pyramid(const DopeVector<T, Dimension> &finest, Kernel kernel, const SizeType levels)
+	    : _finest(finest)
+	    , _kernel(std::move(kernel))
+	{
+		IndexD size = finest.allSizes();
+		if (size.prod() == static_cast<SizeType>(0))
+			return;
+		for (SizeType k = static_cast<SizeType>(1); levels == static_cast<SizeType>(0) ? size != IndexD::Ones() : k < levels; ++k) {
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+				size[d] = (size[d] + 1) / 2;
+			_levels.emplace_back(size);
+		}
+		rebuild();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// LEVELS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SizeType Pyramid<T, Dimension, Allocator>::levelCount() const
+	{
+		return static_cast<SizeType>(_levels.size()) + 1;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline DopeVector<T, Dimension> Pyramid<T, Dimension, Allocator>::level(const SizeType k) const
+	{
+		if (k >= levelCount()) {
+			std::stringstream stream;
+			stream << "Index " << k << " is out of range [0, " << levelCount()-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		return k == static_cast<SizeType>(0) ? _finest : static_cast<const DopeVector<T, Dimension> &>(_levels[k-1]);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// UPDATE
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void Pyramid<T, Dimension, Allocator>::rebuild()
+	{
+		DOPE_TRACE_SCOPE("Pyramid::rebuild");
+		for (SizeType k = static_cast<SizeType>(1); k < levelCount(); ++k)
+			reduce(k, IndexD::Zero(), _levels[k-1].allSizes());
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void Pyramid<T, Dimension, Allocator>::update(const IndexD &start, const IndexD &size)
+	{
+		const IndexD &all = _finest.allSizes();
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			if (start[d] > all[d] || size[d] > all[d] - start[d])
+				internal::throw_window_out_of_range(start[d], size[d], all[d]);
+		if (size.prod() == static_cast<SizeType>(0))
+			return;
+
+		DOPE_TRACE_SCOPE("Pyramid::update");
+		IndexD changedStart(start), changedSize(size);
+		for (SizeType k = static_cast<SizeType>(1); k < levelCount(); ++k) {
+			// parents of the changed children
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				const SizeType end = (changedStart[d] + changedSize[d] - 1) / 2 + 1;
+				changedStart[d] /= 2;
+				changedSize[d] = end - changedStart[d];
+			}
+			reduce(k, changedStart, changedSize);
+		}
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void Pyramid<T, Dimension, Allocator>::reduce(const SizeType k, const IndexD &start, const IndexD &size)
+	{
+		const DopeVector<T, Dimension> children = level(k-1);
+		IndexD childStart, childSize;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			childStart[d] = 2 * start[d];
+			childSize[d] = std::min(2 * (start[d] + size[d]), children.sizeAt(d)) - childStart[d];
+		}
+		const DopeVector<T, Dimension> src = children.window(childStart, childSize);
+		const DopeVector<T, Dimension> dst = level(k).window(start, size);
+		if (_kernel)
+			internal::kernelDownsample(src, dst, _kernel);
+		else
+			internal::boxDownsample(src, dst, typename std::is_arithmetic<T>::type());
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	namespace internal {
+
+		template < typename T, SizeType Dimension >
+		inline void boxDownsample(const DopeVector<T, Dimension> &src, const DopeVector<T, Dimension> &dst, std::true_type)
+		{
+			typedef typename BoxAccumulator<T>::type Accum;
+			const SizeType count = dst.size();
+			if (count == static_cast<SizeType>(0))
+				return;
+			const SizeType *srcSize = src.allSizes().data(), *srcOffset = src.allOffsets().data();
+			const SizeType *dstSize = dst.allSizes().data(), *dstOffset = dst.allOffsets().data();
+			const T *srcOrigin = &*src.begin();
+			T *dstOrigin = const_cast<T *>(&*dst.begin());
+			const SizeType last = dstSize[Dimension-1], srcLast = srcSize[Dimension-1];
+			const SizeType srcStride = srcOffset[Dimension-1], dstStride = dstOffset[Dimension-1];
+			const SizeType pairs = std::min(srcLast / 2, last);
+			const SizeType childRows = power(2, Dimension-1);
+
+			const SizeType grain = std::max(DOPE_PARALLEL_GRAIN / (last * 2 * childRows), static_cast<SizeType>(1));
+			parallel_for(static_cast<SizeType>(0), count / last, grain, [&](const SizeType from, const SizeType to) {
+				std::vector<Accum> sum(last);
+				SizeType parent[Dimension];
+				for (SizeType r = from; r < to; ++r) {
+					SizeType rest = r, dstBase = static_cast<SizeType>(0);
+					for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d) {
+						parent[d-1] = rest % dstSize[d-1];
+						rest /= dstSize[d-1];
+						dstBase += parent[d-1] * dstOffset[d-1];
+					}
+					// add up the child rows along the last dimension, pair
+					// by pair
+					std::fill(sum.begin(), sum.end(), Accum());
+					SizeType rows = static_cast<SizeType>(0);
+					for (SizeType c = static_cast<SizeType>(0); c < childRows; ++c) {
+						SizeType srcBase = static_cast<SizeType>(0);
+						bool inside = true;
+						for (SizeType d = static_cast<SizeType>(0); d + 1 < Dimension && inside; ++d) {
+							const SizeType i = 2 * parent[d] + ((c >> d) & static_cast<SizeType>(1));
+							inside = i < srcSize[d];
+							srcBase += i * srcOffset[d];
+						}
+						if (!inside)
+							continue;
+						++rows;
+						const T *row = srcOrigin + srcBase;
+						for (SizeType j = static_cast<SizeType>(0); j < pairs; ++j)
+							sum[j] += static_cast<Accum>(row[2 * j * srcStride]) + static_cast<Accum>(row[(2 * j + 1) * srcStride]);
+						if (pairs < last)
+							sum[pairs] += static_cast<Accum>(row[2 * pairs * srcStride]);
+					}
+					T *out = dstOrigin + dstBase;
+					for (SizeType j = static_cast<SizeType>(0); j < last; ++j)
+						out[j * dstStride] = static_cast<T>(sum[j] / static_cast<Accum>(j < pairs ? 2 * rows : rows));
+				}
+			});
+		}
+
+		template < typename T, SizeType Dimension >
+		inline void boxDownsample(const DopeVector<T, Dimension> &, const DopeVector<T, Dimension> &, std::false_type)
+		{
+			throw std::invalid_argument("The box filter needs an arithmetic type: give the pyramid a kernel.");
+		}
+
+		template < typename T, SizeType Dimension, class Kernel >
+		inline void kernelDownsample(const DopeVector<T, Dimension> &src, const DopeVector<T, Dimension> &dst, const Kernel &kernel)
+		{
+			const Index<Dimension> &srcSize = src.allSizes();
+			const Layout<Dimension> parents(dst.allSizes());
+			const SizeType grain = std::max(DOPE_PARALLEL_GRAIN / power(2, Dimension), static_cast<SizeType>(1));
+			parallel_for(static_cast<SizeType>(0), dst.size(), grain, [&](const SizeType from, const SizeType to) {
+				DopeVector<T, Dimension> out(dst), children;
+				Index<Dimension> start, size;
+				for (SizeType n = from; n < to; ++n) {
+					const Index<Dimension> parent = parents.to_index(n);
+					for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+						start[d] = 2 * parent[d];
+						size[d] = std::min(static_cast<SizeType>(2), srcSize[d] - start[d]);
+					}
+					src.window(start, size, children);
+					out.at(parent) = kernel(static_cast<const DopeVector<T, Dimension> &>(children));
+				}
+			});
+		}
+
+	}
+
+}
@@ -0,0 +1,208 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <DopeVector/Sampler.hpp>
+#include <DopeVector/internal/Parallel.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension, typename Real >
+	constexpr SizeType Sampler<T, Dimension, Real>::Block;
+
+	template < typename T, SizeType Dimension, typename Real >
+	constexpr SizeType Sampler<T, Dimension, Real>::MaxTaps;
+
+	template < typename T, SizeType Dimension, typename Real >
+	constexpr SizeType Sampler<T, Dimension, Real>::Invalid;
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline Sampler<T, Dimension, Real>::Sampler(const DopeVector<T, Dimension> &view, const Interpolation interpolation, const Border border, const T &border_value)
+	    : _origin(view.size() > static_cast<SizeType>(0) ? &*view.begin() : nullptr)
+	    , _interpolation(interpolation)
+	    , _border(border)
+	    , _borderValue(border_value)
+	{
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			_size[d] = view.sizeAt(d);
+			_stride[d] = view.offsetAt(d);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// SAMPLING
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline T Sampler<T, Dimension, Real>::operator()(const Point &p) const
+	{
+		if (!_origin)
+			return _borderValue;
+		T value;
+		sampleBlock(&p, static_cast<SizeType>(1), &value);
+		return value;
+	}
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline void Sampler<T, Dimension, Real>::sample(const Point *points, const SizeType count, T *out) const
+	{
+		if (!_origin) {
+			std::fill(out, out + count, _borderValue);
+			return;
+		}
+		DOPE_TRACE_SCOPE("Sampler::sample");
+		const SizeType taps = _interpolation == Interpolation::Nearest ? static_cast<SizeType>(1) : _interpolation == Interpolation::Linear ? internal::power(2, Dimension) : MaxTaps;
+		const SizeType grain = std::max(DOPE_PARALLEL_GRAIN / taps, Block);
+		internal::parallel_for(static_cast<SizeType>(0), count, grain, [&](const SizeType from, const SizeType to) {
+			for (SizeType b = from; b < to; b += Block)
+				sampleBlock(points + b, std::min(Block, to - b), out + b);
+		});
+	}
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline void Sampler<T, Dimension, Real>::sampleBlock(const Point *points, const SizeType count, T *out) const
+	{
+		const SizeType width = _interpolation == Interpolation::Nearest ? static_cast<SizeType>(1) : _interpolation == Interpolation::Linear ? static_cast<SizeType>(2) : static_cast<SizeType>(4);
+		const std::ptrdiff_t shift = _interpolation == Interpolation::Cubic ? 1 : 0;
+		const Real rounding = _interpolation == Interpolation::Nearest ? static_cast<Real>(0.5) : static_cast<Real>(0);
+		// keeps indices (and NaNs) representable, far outside any view
+		const Real limit = static_cast<Real>(1 << 30);
+
+		// integer parts and fractions, one dimension at a time
+		std::ptrdiff_t base[Dimension][Block];
+		Real frac[Dimension][Block];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+				Real x = points[n][d] + rounding;
+				x = !(x >= -limit) ? -limit : x > limit ? limit : x;
+				const Real f = std::floor(x);
+				base[d][n] = static_cast<std::ptrdiff_t>(f) - shift;
+				frac[d][n] = x - f;
+			}
+
+		SizeType offsets[MaxTaps];
+		Real weights[MaxTaps];
+		for (SizeType n = static_cast<SizeType>(0); n < count; ++n) {
+			// expand the taps dimension by dimension: taps of the first d
+			// dimensions times the width taps of dimension d
+			SizeType taps = static_cast<SizeType>(1);
+			offsets[0] = static_cast<SizeType>(0);
+			weights[0] = static_cast<Real>(1);
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				const Real t = frac[d][n];
+				Real w[4];
+				switch (_interpolation) {
+				case Interpolation::Nearest:
+					w[0] = static_cast<Real>(1);
+					break;
+				case Interpolation::Linear:
+					w[0] = static_cast<Real>(1) - t;
+					w[1] = t;
+					break;
+				case Interpolation::Cubic:
+					w[0] = static_cast<Real>(0.5) * t * ((static_cast<Real>(2) - t) * t - static_cast<Real>(1));
+					w[1] = static_cast<Real>(0.5) * ((static_cast<Real>(3) * t - static_cast<Real>(5)) * t * t + static_cast<Real>(2));
+					w[2] = static_cast<Real>(0.5) * t * ((static_cast<Real>(4) - static_cast<Real>(3) * t) * t + static_cast<Real>(1));
+					w[3] = static_cast<Real>(0.5) * (t - static_cast<Real>(1)) * t * t;
+					break;
+				}
+				for (SizeType k = width; k > static_cast<SizeType>(0); --k) {
+					const SizeType o = resolve(d, base[d][n] + static_cast<std::ptrdiff_t>(k - 1));
+					for (SizeType i = static_cast<SizeType>(0); i < taps; ++i) {
+						const SizeType to = (k - 1) * taps + i;
+						offsets[to] = o == Invalid || offsets[i] == Invalid ? Invalid : offsets[i] + o;
+						weights[to] = weights[i] * w[k-1];
+					}
+				}
+				taps *= width;
+			}
+
+			if (taps == static_cast<SizeType>(1)) {
+				out[n] = offsets[0] == Invalid ? _borderValue : _origin[offsets[0]];
+				continue;
+			}
+			Accum sum = static_cast<Accum>(offsets[0] == Invalid ? _borderValue : _origin[offsets[0]]) * weights[0];
+			for (SizeType i = static_cast<SizeType>(1); i < taps; ++i)
+				sum += static_cast<Accum>(offsets[i] == Invalid ? _borderValue : _origin[offsets[i]]) * weights[i];
+			out[n] = toValue(sum, std::is_integral<T>());
+		}
+	}
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline T Sampler<T, Dimension, Real>::toValue(const Accum &sum, std::true_type)
+	{
+		// the weights add up to 1 only up to rounding errors, so truncating
+		// would bias the result of a constant neighbourhood down by one
+		const Accum rounded = std::floor(sum + static_cast<Accum>(0.5));
+		if (rounded <= static_cast<Accum>(std::numeric_limits<T>::lowest()))
+			return std::numeric_limits<T>::lowest();
+		if (rounded >= static_cast<Accum>(std::numeric_limits<T>::max()))
+			return std::numeric_limits<T>::max();
+		return static_cast<T>(rounded);
+	}
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline T Sampler<T, Dimension, Real>::toValue(const Accum &sum, std::false_type)
+	{
+		return static_cast<T>(sum);
+	}
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline SizeType Sampler<T, Dimension, Real>::resolve(const SizeType d, std::ptrdiff_t i) const
+	{
+		const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(_size[d]);
+		if (i < 0 || i >= size) {
+			switch (_border) {
+			case Border::Clamp:
+				i = i < 0 ? 0 : size - 1;
+				break;
+			case Border::Repeat:
+				i = (i % size + size) % size;
+				break;
+			case Border::Constant:
+				return Invalid;
+			}
+		}
+		return static_cast<SizeType>(i) * _stride[d];
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline Interpolation Sampler<T, Dimension, Real>::interpolation() const
+	{
+		return _interpolation;
+	}
+
+	template < typename T, SizeType Dimension, typename Real >
+	inline Border Sampler<T, Dimension, Real>::border() const
+	{
+		return _border;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
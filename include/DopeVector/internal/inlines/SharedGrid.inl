@@ -0,0 +1,231 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <utility>
+#include <DopeVector/SharedGrid.hpp>
+
+namespace dope {
+
+	////////////////////////////////////////////////////////////////////////////
+	// SHARED VIEW
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension >
+	inline SharedView<T, Dimension>::SharedView(const DopeVector<T, Dimension> &view, Owner owner)
+	    : DopeVector<T, Dimension>(view)
+	    , _owner(std::move(owner))
+	{ }
+
+	template < typename T, SizeType Dimension >
+	inline SharedView<T, Dimension> SharedView<T, Dimension>::window(const IndexD &start, const IndexD &size) const
+	{
+		return SharedView(DopeVector<T, Dimension>::window(start, size), _owner);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline void SharedView<T, Dimension>::window(const IndexD &start, const IndexD &size, DopeVector<T, Dimension> &w) const
+	{
+		DopeVector<T, Dimension>::window(start, size, w);
+	}
+
+	template < typename T, SizeType Dimension >
+	template < SizeType D >
+	inline typename std::enable_if<(D == 1), SharedView<T, D>>::type SharedView<T, Dimension>::window(const SizeType start, const SizeType size) const
+	{
+		return SharedView(DopeVector<T, Dimension>::window(start, size), _owner);
+	}
+
+	template < typename T, SizeType Dimension >
+	template < SizeType D >
+	inline typename std::enable_if<(D == 1)>::type SharedView<T, Dimension>::window(const SizeType start, const SizeType size, DopeVector<T, D> &w) const
+	{
+		DopeVector<T, Dimension>::window(start, size, w);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SharedView<T, Dimension> SharedView<T, Dimension>::permute(const IndexD &order) const
+	{
+		return SharedView(DopeVector<T, Dimension>::permute(order), _owner);
+	}
+
+	template < typename T, SizeType Dimension >
+	template < SizeType D >
+	inline typename std::enable_if<(D > 1), SharedView<T, D-1>>::type SharedView<T, Dimension>::slice(const SizeType d, const SizeType i) const
+	{
+		return SharedView<T, D-1>(DopeVector<T, Dimension>::slice(d, i), _owner);
+	}
+
+	template < typename T, SizeType Dimension >
+	template < SizeType D >
+	inline typename std::enable_if<(D > 1)>::type SharedView<T, Dimension>::slice(const SizeType d, const SizeType i, DopeVector<T, D-1> &s) const
+	{
+		DopeVector<T, Dimension>::slice(d, i, s);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline const typename SharedView<T, Dimension>::Owner & SharedView<T, Dimension>::owner() const
+	{
+		return _owner;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator>::SharedGrid(const IndexD &size, const T &default_value)
+	{
+		resize(size, default_value);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator>::SharedGrid(const SizeType size, const T &default_value)
+	{
+		resize(size, default_value);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator>::SharedGrid(const DopeVector<T, Dimension> &o)
+	    : SharedGrid(o.allSizes())
+	{
+		DopeVector<T, Dimension>::import(o);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator>::SharedGrid(const SharedGrid &o)
+	    : DopeVector<T, Dimension>()
+	{
+		*this = o;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator>::SharedGrid(SharedGrid &&o)
+	    : DopeVector<T, Dimension>(o)
+	    , _data(std::move(o._data))
+	{
+		o.clear();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// DATA
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const T * SharedGrid<T, Dimension, Allocator>::data() const
+	{
+		return _data ? _data->data() : nullptr;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline T * SharedGrid<T, Dimension, Allocator>::data()
+	{
+		return _data ? _data->data() : nullptr;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline const std::shared_ptr<typename SharedGrid<T, Dimension, Allocator>::Data> & SharedGrid<T, Dimension, Allocator>::buffer() const
+	{
+		return _data;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedView<T, Dimension> SharedGrid<T, Dimension, Allocator>::view() const
+	{
+		return SharedView<T, Dimension>(*this, _data);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline bool SharedGrid<T, Dimension, Allocator>::empty() const
+	{
+		return !_data || _data->empty();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RESET
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void SharedGrid<T, Dimension, Allocator>::clear()
+	{
+		_data.reset();
+		DopeVector<T, Dimension>::reset(nullptr, static_cast<SizeType>(0), IndexD::Zero());
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void SharedGrid<T, Dimension, Allocator>::resize(const IndexD &size, const T &default_value)
+	{
+		DOPE_TRACE_SCOPE("SharedGrid::resize");
+		_data = std::make_shared<Data>(size.prod(), default_value);
+		DopeVector<T, Dimension>::reset(_data->data(), static_cast<SizeType>(0), size);
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline void SharedGrid<T, Dimension, Allocator>::resize(const SizeType size, const T &default_value)
+	{
+		resize(IndexD::Constant(size), default_value);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ASSIGNMENTS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator> & SharedGrid<T, Dimension, Allocator>::operator=(const SharedGrid &o)
+	{
+		if (&o != this) {
+			if (!o._data) {
+				clear();
+				return *this;
+			}
+			DOPE_TRACE_SCOPE("SharedGrid::copy");
+			_data = std::make_shared<Data>(*o._data);
+			DopeVector<T, Dimension>::reset(_data->data(), static_cast<SizeType>(0), o.allSizes(), o.allOffsets());
+		}
+		return *this;
+	}
+
+	template < typename T, SizeType Dimension, class Allocator >
+	inline SharedGrid<T, Dimension, Allocator> & SharedGrid<T, Dimension, Allocator>::operator=(SharedGrid &&o)
+	{
+		if (&o != this) {
+			DopeVector<T, Dimension>::operator=(o);
+			_data = std::move(o._data);
+			o.clear();
+		}
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,235 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <type_traits>
+#include <DopeVector/SlabStream.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		inline SizeType slabThicknessFor(const SizeType memoryBudget, const SizeType ringSize, const SizeType rowBytes, const SizeType extraRows, const SizeType totalRows)
+		{
+			if (ringSize == static_cast<SizeType>(0))
+				throw std::invalid_argument("The ring must hold at least one slab.");
+			const SizeType rowsPerBuffer = rowBytes == static_cast<SizeType>(0) ? totalRows + extraRows : memoryBudget / (ringSize * rowBytes);
+			if (rowsPerBuffer <= extraRows) {
+				std::stringstream stream;
+				stream << "Memory budget " << memoryBudget << " can not hold " << ringSize << " slabs of at least " << extraRows + 1 << " rows of " << rowBytes << " bytes.";
+				throw std::invalid_argument(stream.str());
+			}
+			return std::max(static_cast<SizeType>(1), std::min(rowsPerBuffer - extraRows, totalRows));
+		}
+
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+	// SLAB READER
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension >
+	inline SlabReader<T, Dimension>::SlabReader(std::istream &stream, const IndexD &size, const SizeType memoryBudget, const SizeType halo, const SizeType ringSize)
+	    : _stream(stream)
+	    , _size(size)
+	    , _rowSize(size.prod() / std::max(size[0], static_cast<SizeType>(1)))
+	    , _halo(halo)
+	    , _thickness(internal::slabThicknessFor(memoryBudget, ringSize, _rowSize * sizeof(T), 2 * halo, size[0]))
+	    , _ring(ringSize)
+	    , _next(static_cast<SizeType>(0))
+	    , _rowsRead(static_cast<SizeType>(0))
+	    , _viewStart(static_cast<SizeType>(0))
+	    , _viewEnd(static_cast<SizeType>(0))
+	    , _coreStart(static_cast<SizeType>(0))
+	    , _coreEnd(static_cast<SizeType>(0))
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be streamed.");
+		const SizeType bufferRows = std::min(_thickness + 2 * _halo, _size[0]);
+		for (std::vector<T> &buffer : _ring)
+			buffer.resize(bufferRows * _rowSize);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline bool SlabReader<T, Dimension>::next(DopeVector<T, Dimension> &slab)
+	{
+		DOPE_TRACE_SCOPE("SlabReader::next");
+		if (_next >= slabCount())
+			return false;
+
+		const SizeType coreStart = _next * _thickness;
+		const SizeType coreEnd = std::min(coreStart + _thickness, _size[0]);
+		const SizeType viewStart = coreStart > _halo ? coreStart - _halo : static_cast<SizeType>(0);
+		const SizeType viewEnd = std::min(coreEnd + _halo, _size[0]);
+
+		std::vector<T> &buffer = _ring[_next % _ring.size()];
+		if (_next > static_cast<SizeType>(0) && _viewEnd > viewStart) {
+			// the overlap with the previous slab is already in memory
+			const T *previous = _ring[(_next - 1) % _ring.size()].data();
+			std::memmove(buffer.data(), previous + (viewStart - _viewStart) * _rowSize, (_viewEnd - viewStart) * _rowSize * sizeof(T));
+		}
+		const SizeType firstNew = _rowsRead - viewStart;
+		const SizeType bytes = (viewEnd - _rowsRead) * _rowSize * sizeof(T);
+		_stream.read(reinterpret_cast<char *>(buffer.data() + firstNew * _rowSize), static_cast<std::streamsize>(bytes));
+		if (static_cast<SizeType>(_stream.gcount()) != bytes) {
+			std::stringstream stream;
+			stream << "Stream ended at row " << _rowsRead << " of " << _size[0] << '.';
+			throw std::runtime_error(stream.str());
+		}
+
+		_rowsRead = viewEnd;
+		_viewStart = viewStart;
+		_viewEnd = viewEnd;
+		_coreStart = coreStart;
+		_coreEnd = coreEnd;
+		++_next;
+
+		IndexD viewSize = _size;
+		viewSize[0] = viewEnd - viewStart;
+		_current.reset(buffer.data(), viewStart * _rowSize, viewSize);
+		slab = _current;
+		return true;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline DopeVector<T, Dimension> SlabReader<T, Dimension>::core() const
+	{
+		IndexD start = IndexD::Zero(), size = _current.allSizes();
+		start[0] = _coreStart - _viewStart;
+		size[0] = _coreEnd - _coreStart;
+		return _current.window(start, size);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline const typename SlabReader<T, Dimension>::IndexD & SlabReader<T, Dimension>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabReader<T, Dimension>::slabThickness() const
+	{
+		return _thickness;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabReader<T, Dimension>::slabCount() const
+	{
+		return (_size[0] + _thickness - 1) / _thickness;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabReader<T, Dimension>::slabStart() const
+	{
+		return _viewStart;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabReader<T, Dimension>::haloBefore() const
+	{
+		return _coreStart - _viewStart;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// SLAB WRITER
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension >
+	inline SlabWriter<T, Dimension>::SlabWriter(std::ostream &stream, const IndexD &size, const SizeType memoryBudget, const SizeType ringSize)
+	    : _stream(stream)
+	    , _size(size)
+	    , _rowSize(size.prod() / std::max(size[0], static_cast<SizeType>(1)))
+	    , _thickness(internal::slabThicknessFor(memoryBudget, ringSize, _rowSize * sizeof(T), static_cast<SizeType>(0), size[0]))
+	    , _ring(ringSize)
+	    , _next(static_cast<SizeType>(0))
+	    , _written(static_cast<SizeType>(0))
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be streamed.");
+		for (std::vector<T> &buffer : _ring)
+			buffer.resize(_thickness * _rowSize);
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SlabWriter<T, Dimension>::~SlabWriter()
+	{
+		try {
+			writePending(_next);
+		} catch (...) { }
+	}
+
+	template < typename T, SizeType Dimension >
+	inline bool SlabWriter<T, Dimension>::next(DopeVector<T, Dimension> &slab)
+	{
+		if (_next >= slabCount())
+			return false;
+		// recycle the oldest buffer
+		if (_next >= _ring.size() && !writePending(_next - _ring.size() + 1))
+			throw std::runtime_error("Failed writing slab to stream.");
+
+		const SizeType start = _next * _thickness;
+		IndexD slabSize = _size;
+		slabSize[0] = std::min(_thickness, _size[0] - start);
+		slab.reset(_ring[_next % _ring.size()].data(), start * _rowSize, slabSize);
+		++_next;
+		return true;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline void SlabWriter<T, Dimension>::flush()
+	{
+		if (!writePending(_next))
+			throw std::runtime_error("Failed writing slab to stream.");
+		_stream.flush();
+	}
+
+	template < typename T, SizeType Dimension >
+	inline bool SlabWriter<T, Dimension>::writePending(const SizeType upTo)
+	{
+		DOPE_TRACE_SCOPE("SlabWriter::write");
+		for (; _written < upTo; ++_written) {
+			const SizeType start = _written * _thickness;
+			const SizeType rows = std::min(_thickness, _size[0] - start);
+			_stream.write(reinterpret_cast<const char *>(_ring[_written % _ring.size()].data()), static_cast<std::streamsize>(rows * _rowSize * sizeof(T)));
+			if (!_stream)
+				return false;
+		}
+		return true;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline const typename SlabWriter<T, Dimension>::IndexD & SlabWriter<T, Dimension>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabWriter<T, Dimension>::slabThickness() const
+	{
+		return _thickness;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabWriter<T, Dimension>::slabCount() const
+	{
+		return (_size[0] + _thickness - 1) / _thickness;
+	}
+
+	template < typename T, SizeType Dimension >
+	inline SizeType SlabWriter<T, Dimension>::slabStart() const
+	{
+		return _next > static_cast<SizeType>(0) ? (_next - 1) * _thickness : static_cast<SizeType>(0);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
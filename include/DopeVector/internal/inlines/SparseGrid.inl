@@ -0,0 +1,287 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <DopeVector/SparseGrid.hpp>
+
+namespace dope {
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	constexpr SizeType SparseGrid<T, Dimension, BlockSize>::BlockVolume;
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SparseGrid<T, Dimension, BlockSize>::SparseGrid()
+	    : _size(IndexD::Zero())
+	    , _blocks(IndexD::Zero())
+	    , _background()
+	{ }
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SparseGrid<T, Dimension, BlockSize>::SparseGrid(const IndexD &size, const T &background)
+	    : SparseGrid()
+	{
+		resize(size, background);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SparseGrid<T, Dimension, BlockSize>::SparseGrid(const DopeVector<T, Dimension> &o, const T &background)
+	    : SparseGrid(o.allSizes(), background)
+	{
+		import(o);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ACCESS METHODS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SizeType SparseGrid<T, Dimension, BlockSize>::blockPosition(const IndexD &i, SizeType &local) const
+	{
+		SizeType b = static_cast<SizeType>(0);
+		local = static_cast<SizeType>(0);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			Check::index(i[d], _size[d]);
+			b = b * _blocks[d] + i[d] / BlockSize;
+			local = local * BlockSize + i[d] % BlockSize;
+		}
+		return b;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SizeType SparseGrid<T, Dimension, BlockSize>::activate(const SizeType b)
+	{
+		typename std::unordered_map<SizeType, SizeType>::const_iterator it = _table.find(b);
+		if (it != _table.end())
+			return it->second;
+		std::unique_ptr<T[]> block(new T[BlockVolume]);
+		std::fill(block.get(), block.get() + BlockVolume, _background);
+		const SizeType slot = _storage.size();
+		_storage.push_back(std::move(block));
+		_keys.push_back(b);
+		_table.emplace(b, slot);
+		return slot;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline const T & SparseGrid<T, Dimension, BlockSize>::at(const IndexD &i) const
+	{
+		SizeType local;
+		typename std::unordered_map<SizeType, SizeType>::const_iterator it = _table.find(blockPosition(i, local));
+		if (it == _table.end())
+			return _background;
+		return _storage[it->second][local];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline T & SparseGrid<T, Dimension, BlockSize>::at(const IndexD &i)
+	{
+		SizeType local;
+		const SizeType b = blockPosition(i, local);
+		return _storage[activate(b)][local];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline const T & SparseGrid<T, Dimension, BlockSize>::operator[](const IndexD &i) const
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline T & SparseGrid<T, Dimension, BlockSize>::operator[](const IndexD &i)
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline bool SparseGrid<T, Dimension, BlockSize>::isActive(const IndexD &i) const
+	{
+		SizeType local;
+		return _table.count(blockPosition(i, local)) != static_cast<SizeType>(0);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BLOCKS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SizeType SparseGrid<T, Dimension, BlockSize>::activeBlockCount() const
+	{
+		return _storage.size();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline DopeVector<T, Dimension> SparseGrid<T, Dimension, BlockSize>::blockView(const SizeType slot) const
+	{
+		const IndexD origin = activeBlockOrigin(slot);
+		IndexD size, offset;
+		offset[Dimension-1] = 1;
+		for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d)
+			offset[d-1] = BlockSize * offset[d];
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			size[d] = std::min(BlockSize, _size[d] - origin[d]);
+		return DopeVector<T, Dimension>(_storage[slot].get(), static_cast<SizeType>(0), size, offset);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline DopeVector<T, Dimension> SparseGrid<T, Dimension, BlockSize>::activeBlock(const SizeType k) const
+	{
+		if (k >= _storage.size()) {
+			std::stringstream stream;
+			stream << "Index " << k << " is out of range [0, " << static_cast<SizeType>(_storage.size())-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		return blockView(k);
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline typename SparseGrid<T, Dimension, BlockSize>::IndexD SparseGrid<T, Dimension, BlockSize>::activeBlockOrigin(const SizeType k) const
+	{
+		IndexD origin = to_index(_keys.at(k), _blocks);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			origin[d] *= BlockSize;
+		return origin;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline DopeVector<T, Dimension> SparseGrid<T, Dimension, BlockSize>::block(const IndexD &b)
+	{
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			if (b[d] >= _blocks[d]) {
+				std::stringstream stream;
+				stream << "Index " << b[d] << " is out of range [0, " << _blocks[d]-1 << ']';
+				throw std::out_of_range(stream.str());
+			}
+		return blockView(activate(to_position(b, _blocks)));
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERSIONS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline void SparseGrid<T, Dimension, BlockSize>::import(const DopeVector<T, Dimension> &o)
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		const SizeType count = _blocks.prod();
+		for (SizeType b = static_cast<SizeType>(0); b < count; ++b) {
+			IndexD origin = to_index(b, _blocks), size;
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				origin[d] *= BlockSize;
+				size[d] = std::min(BlockSize, _size[d] - origin[d]);
+			}
+			const DopeVector<T, Dimension> src = o.window(origin, size);
+			if (_table.count(b) == static_cast<SizeType>(0)) {
+				bool background = true;
+				for (typename DopeVector<T, Dimension>::const_iterator it = src.cbegin(); background && it != src.cend(); ++it)
+					background = *it == _background;
+				if (background)
+					continue;
+			}
+			blockView(activate(b)).import(src);
+		}
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline void SparseGrid<T, Dimension, BlockSize>::exportTo(DopeVector<T, Dimension> &o) const
+	{
+		if (_size != o.allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		for (typename DopeVector<T, Dimension>::iterator it = o.begin(); it != o.end(); ++it)
+			*it = _background;
+		for (SizeType k = static_cast<SizeType>(0); k < _storage.size(); ++k) {
+			const DopeVector<T, Dimension> src = blockView(k);
+			DopeVector<T, Dimension> dst = o.window(activeBlockOrigin(k), src.allSizes());
+			dst.import(src);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline const typename SparseGrid<T, Dimension, BlockSize>::IndexD & SparseGrid<T, Dimension, BlockSize>::allSizes() const
+	{
+		return _size;
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SizeType SparseGrid<T, Dimension, BlockSize>::sizeAt(const SizeType d) const
+	{
+		if (d >= Dimension) {
+			std::stringstream stream;
+			stream << "Index " << d << " is out of range [0, " << Dimension-1 << ']';
+			throw std::out_of_range(stream.str());
+		}
+		return _size[d];
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline SizeType SparseGrid<T, Dimension, BlockSize>::size() const
+	{
+		return _size.prod();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline const T & SparseGrid<T, Dimension, BlockSize>::background() const
+	{
+		return _background;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RESET
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline void SparseGrid<T, Dimension, BlockSize>::clear()
+	{
+		_table.clear();
+		_storage.clear();
+		_keys.clear();
+	}
+
+	template < typename T, SizeType Dimension, SizeType BlockSize >
+	inline void SparseGrid<T, Dimension, BlockSize>::resize(const IndexD &size, const T &background)
+	{
+		clear();
+		_size = size;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			_blocks[d] = (size[d] + BlockSize - 1) / BlockSize;
+		_background = background;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,266 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <DopeVector/StaticGrid.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		template < SizeType Size, SizeType ... Sizes >
+		constexpr SizeType StaticExtents<Size, Sizes...>::Dimension;
+
+		template < SizeType Size, SizeType ... Sizes >
+		constexpr SizeType StaticExtents<Size, Sizes...>::Volume;
+
+		template < SizeType Size, SizeType ... Sizes >
+		constexpr SizeType StaticExtents<Size, Sizes...>::Stride;
+
+	}
+
+	template < typename T, SizeType ... Sizes >
+	constexpr SizeType StaticGrid<T, Sizes...>::Dimension;
+
+	template < typename T, SizeType ... Sizes >
+	constexpr SizeType StaticGrid<T, Sizes...>::Volume;
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType ... Sizes >
+	inline StaticGrid<T, Sizes...>::StaticGrid()
+	    : _data()
+	{ }
+
+	template < typename T, SizeType ... Sizes >
+	inline StaticGrid<T, Sizes...>::StaticGrid(const T &default_value)
+	{
+		_data.fill(default_value);
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline StaticGrid<T, Sizes...>::StaticGrid(const DopeVector<T, Dimension> &o)
+	{
+		import(o);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ACCESS METHODS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType ... Sizes >
+	inline SizeType StaticGrid<T, Sizes...>::position(const IndexD &i)
+	{
+		SizeType p = static_cast<SizeType>(0);
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+			Check::index(i[d], Extents::sizeAt(d));
+			p += i[d] * Extents::strideAt(d);
+		}
+		return p;
+	}
+
+	template < typename T, SizeType ... Sizes > template < typename ... Args >
+	inline const T & StaticGrid<T, Sizes...>::operator()(const Args ... is) const
+	{
+		static_assert(sizeof...(Args) == Dimension, "Wrong number of index components.");
+		const SizeType i[Dimension] = { static_cast<SizeType>(is)... };
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			Check::index(i[d], Extents::sizeAt(d));
+		return _data[Extents::position(static_cast<SizeType>(is)...)];
+	}
+
+	template < typename T, SizeType ... Sizes > template < typename ... Args >
+	inline T & StaticGrid<T, Sizes...>::operator()(const Args ... is)
+	{
+		return const_cast<T &>(static_cast<const StaticGrid &>(*this)(is...));
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline const T & StaticGrid<T, Sizes...>::at(const IndexD &i) const
+	{
+		return _data[position(i)];
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline T & StaticGrid<T, Sizes...>::at(const IndexD &i)
+	{
+		return _data[position(i)];
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline const T & StaticGrid<T, Sizes...>::operator[](const IndexD &i) const
+	{
+		return at(i);
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline T & StaticGrid<T, Sizes...>::operator[](const IndexD &i)
+	{
+		return at(i);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// ITERATORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType ... Sizes >
+	inline typename StaticGrid<T, Sizes...>::iterator StaticGrid<T, Sizes...>::begin()
+	{
+		return _data.data();
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline typename StaticGrid<T, Sizes...>::iterator StaticGrid<T, Sizes...>::end()
+	{
+		return _data.data() + Volume;
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline typename StaticGrid<T, Sizes...>::const_iterator StaticGrid<T, Sizes...>::begin() const
+	{
+		return _data.data();
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline typename StaticGrid<T, Sizes...>::const_iterator StaticGrid<T, Sizes...>::end() const
+	{
+		return _data.data() + Volume;
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONVERSIONS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType ... Sizes >
+	inline DopeVector<T, StaticGrid<T, Sizes...>::Dimension> StaticGrid<T, Sizes...>::view()
+	{
+		return DopeVector<T, Dimension>(_data.data(), static_cast<SizeType>(0), allSizes(), allOffsets());
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline const DopeVector<T, StaticGrid<T, Sizes...>::Dimension> StaticGrid<T, Sizes...>::view() const
+	{
+		return DopeVector<T, Dimension>(const_cast<T *>(_data.data()), static_cast<SizeType>(0), allSizes(), allOffsets());
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline StaticGrid<T, Sizes...>::operator DopeVector<T, StaticGrid<T, Sizes...>::Dimension>()
+	{
+		return view();
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline StaticGrid<T, Sizes...>::operator const DopeVector<T, StaticGrid<T, Sizes...>::Dimension>() const
+	{
+		return view();
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline void StaticGrid<T, Sizes...>::import(const DopeVector<T, Dimension> &o)
+	{
+		if (o.allSizes() != allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		view().import(o);
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline void StaticGrid<T, Sizes...>::exportTo(DopeVector<T, Dimension> &o) const
+	{
+		if (o.allSizes() != allSizes())
+			throw std::out_of_range("Matrixes do not have same size.");
+		o.import(view());
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// INFORMATION
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType ... Sizes >
+	inline typename StaticGrid<T, Sizes...>::IndexD StaticGrid<T, Sizes...>::allSizes()
+	{
+		IndexD size;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			size[d] = Extents::sizeAt(d);
+		return size;
+	}
+
+	template < typename T, SizeType ... Sizes >
+	constexpr SizeType StaticGrid<T, Sizes...>::sizeAt(const SizeType d)
+	{
+		return Extents::sizeAt(d);
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline typename StaticGrid<T, Sizes...>::IndexD StaticGrid<T, Sizes...>::allOffsets()
+	{
+		IndexD offset;
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			offset[d] = Extents::strideAt(d);
+		return offset;
+	}
+
+	template < typename T, SizeType ... Sizes >
+	constexpr SizeType StaticGrid<T, Sizes...>::offsetAt(const SizeType d)
+	{
+		return Extents::strideAt(d);
+	}
+
+	template < typename T, SizeType ... Sizes >
+	constexpr SizeType StaticGrid<T, Sizes...>::size()
+	{
+		return Volume;
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline const T * StaticGrid<T, Sizes...>::data() const
+	{
+		return _data.data();
+	}
+
+	template < typename T, SizeType ... Sizes >
+	inline T * StaticGrid<T, Sizes...>::data()
+	{
+		return _data.data();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// RESET
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType ... Sizes >
+	inline void StaticGrid<T, Sizes...>::fill(const T &value)
+	{
+		_data.fill(value);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <DopeVector/internal/SubView.hpp>
+
+namespace dope {
+
+	namespace internal {
+
+		template < typename T, SizeType Dimension, BoundsCheck Policy >
+		inline SubView<T, Dimension, Policy>::SubView(T *array, const SizeType accumulatedOffset, const SizeType *size, const SizeType *offset)
+		    : _array(array)
+		    , _accumulatedOffset(accumulatedOffset)
+		    , _size(size)
+		    , _offset(offset)
+		{ }
+
+		template < typename T, SizeType Dimension, BoundsCheck Policy >
+		inline SubView<T, Dimension-1, Policy> SubView<T, Dimension, Policy>::operator[](const SizeType i) const
+		{
+			Bounds<Policy>::index(i, _size[0]);
+			return SubView<T, Dimension-1, Policy>(_array + _offset[0] * i, _accumulatedOffset + _offset[0] * i, _size + 1, _offset + 1);
+		}
+
+		template < typename T, SizeType Dimension, BoundsCheck Policy >
+		inline SubView<T, Dimension, Policy>::operator DopeVector<T, Dimension>() const
+		{
+			Index<Dimension> size, offset;
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d) {
+				size[d] = _size[d];
+				offset[d] = _offset[d];
+			}
+			return DopeVector<T, Dimension>(_array, _accumulatedOffset, size, offset);
+		}
+
+
+
+		template < typename T, BoundsCheck Policy >
+		inline SubView<T, 1, Policy>::SubView(T *array, const SizeType accumulatedOffset, const SizeType *size, const SizeType *offset)
+		    : _array(array)
+		    , _accumulatedOffset(accumulatedOffset)
+		    , _size(size)
+		    , _offset(offset)
+		{ }
+
+		template < typename T, BoundsCheck Policy >
+		inline T & SubView<T, 1, Policy>::operator[](const SizeType i) const
+		{
+			Bounds<Policy>::index(i, _size[0]);
+			return *(_array + _offset[0] * i);
+		}
+
+		template < typename T, BoundsCheck Policy >
+		inline SubView<T, 1, Policy>::operator DopeVector<T, 1>() const
+		{
+			return DopeVector<T, 1>(_array, _accumulatedOffset, _size[0], _offset[0]);
+		}
+
+	}
+
+}
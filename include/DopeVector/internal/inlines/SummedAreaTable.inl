@@ -0,0 +1,151 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <algorithm>
+#include <DopeVector/SummedAreaTable.hpp>
+#include <DopeVector/internal/Parallel.hpp>
+
+namespace dope {
+
+	////////////////////////////////////////////////////////////////////////////
+	// CONSTRUCTORS
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, typename Accum, class Allocator >
+	inline SummedAreaTable<T, Dimension, Accum, Allocator>::SummedAreaTable(const DopeVector<T, Dimension> &view)
+	{
+		build(view);
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// BUILD
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, typename Accum, class Allocator >
+	inline void SummedAreaTable<T, Dimension, Accum, Allocator>::build(const DopeVector<T, Dimension> &view)
+	{
+		_table.resize(view.allSizes());
+		const SizeType count = view.size();
+		if (count == static_cast<SizeType>(0))
+			return;
+
+		DOPE_TRACE_SCOPE("SummedAreaTable::build");
+		const SizeType *size = view.allSizes().data(), *offset = view.allOffsets().data();
+		const T *origin = &*view.begin();
+		Accum *table = _table.data();
+
+		// scan the lines along the last dimension, from the view
+		const SizeType last = size[Dimension-1], stride = offset[Dimension-1];
+		internal::parallel_for(static_cast<SizeType>(0), count / last, std::max(DOPE_PARALLEL_GRAIN / last, static_cast<SizeType>(1)), [&](const SizeType from, const SizeType to) {
+			for (SizeType r = from; r < to; ++r) {
+				SizeType rest = r, base = static_cast<SizeType>(0);
+				for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d) {
+					base += (rest % size[d-1]) * offset[d-1];
+					rest /= size[d-1];
+				}
+				const T *in = origin + base;
+				Accum *out = table + r * last;
+				Accum sum = static_cast<Accum>(in[0]);
+				out[0] = sum;
+				for (SizeType j = static_cast<SizeType>(1); j < last; ++j) {
+					sum += static_cast<Accum>(in[j * stride]);
+					out[j] = sum;
+				}
+			}
+		});
+
+		// then, along each other dimension d, add each row of the table to
+		// the next one, rows being contiguous
+		SizeType inner = last;
+		for (SizeType d = Dimension-1; d > static_cast<SizeType>(0); --d) {
+			const SizeType n = size[d-1], outer = count / (inner * n);
+			internal::parallel_for(static_cast<SizeType>(0), outer * inner, std::max(DOPE_PARALLEL_GRAIN / n, static_cast<SizeType>(1)), [&](const SizeType from, const SizeType to) {
+				for (SizeType c = from; c < to; ) {
+					// the columns of [from, to) in the same block of rows
+					const SizeType o = c / inner, j = c % inner;
+					const SizeType run = std::min(inner - j, to - c);
+					Accum *block = table + o * n * inner + j;
+					for (SizeType i = static_cast<SizeType>(1); i < n; ++i) {
+						const Accum *previous = block + (i - 1) * inner;
+						Accum *row = block + i * inner;
+						for (SizeType k = static_cast<SizeType>(0); k < run; ++k)
+							row[k] += previous[k];
+					}
+					c += run;
+				}
+			});
+			inner *= n;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+
+
+	////////////////////////////////////////////////////////////////////////////
+	// QUERIES
+	////////////////////////////////////////////////////////////////////////////
+
+	template < typename T, SizeType Dimension, typename Accum, class Allocator >
+	inline Accum SummedAreaTable<T, Dimension, Accum, Allocator>::regionSum(const IndexD &start, const IndexD &size) const
+	{
+		const IndexD &all = _table.allSizes();
+		for (SizeType d = static_cast<SizeType>(0); d < Dimension; ++d)
+			if (start[d] > all[d] || size[d] > all[d] - start[d])
+				internal::throw_window_out_of_range(start[d], size[d], all[d]);
+		if (size.prod() == static_cast<SizeType>(0))
+			return Accum();
+
+		// inclusion-exclusion over the 2^D corners before and at the end of
+		// the window: a corner is skipped if it is before the first element
+		const SizeType *offset = _table.allOffsets().data();
+		const Accum *table = _table.data();
+		Accum sum = Accum();
+		for (SizeType c = static_cast<SizeType>(0); c < internal::power(2, Dimension); ++c) {
+			SizeType at = static_cast<SizeType>(0), before = static_cast<SizeType>(0);
+			bool inside = true;
+			for (SizeType d = static_cast<SizeType>(0); d < Dimension && inside; ++d) {
+				if ((c >> d) & static_cast<SizeType>(1)) {
+					inside = start[d] > static_cast<SizeType>(0);
+					at += (start[d] - 1) * offset[d];
+					++before;
+				} else {
+					at += (start[d] + size[d] - 1) * offset[d];
+				}
+			}
+			if (!inside)
+				continue;
+			if (before % static_cast<SizeType>(2) == static_cast<SizeType>(0))
+				sum += table[at];
+			else
+				sum -= table[at];
+		}
+		return sum;
+	}
+
+	template < typename T, SizeType Dimension, typename Accum, class Allocator >
+	inline const typename SummedAreaTable<T, Dimension, Accum, Allocator>::Table & SummedAreaTable<T, Dimension, Accum, Allocator>::table() const
+	{
+		return _table;
+	}
+
+	template < typename T, SizeType Dimension, typename Accum, class Allocator >
+	inline const typename SummedAreaTable<T, Dimension, Accum, Allocator>::IndexD & SummedAreaTable<T, Dimension, Accum, Allocator>::allSizes() const
+	{
+		return _table.allSizes();
+	}
+
+	////////////////////////////////////////////////////////////////////////////
+
+}
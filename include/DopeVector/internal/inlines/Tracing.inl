@@ -0,0 +1,174 @@
+// Copyright (c) 2016 Giorgio Marcias & Maurizio Kovacic
+//
+// This source code is part of DopeVector header library
+// and it is subject to Apache 2.0 License.
+//
+// Author: Giorgio Marcias
+// email: marcias.giorgio@gmail.com
+// Author: Maurizio Kovacic
+// email: maurizio.kovacic@gmail.com
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <DopeVector/Tracing.hpp>
+
+namespace dope {
+
+	constexpr bool Tracing::enabled()
+	{
+#ifdef DOPE_USE_TRACING
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	inline void Tracing::writeChromeTrace(std::ostream &out)
+	{
+		std::vector<std::shared_ptr<internal::TraceBuffer>> buffers;
+		{
+			std::lock_guard<std::mutex> lock(internal::traceRegistry().mutex);
+			buffers = internal::traceRegistry().buffers;
+		}
+		const std::ios_base::fmtflags flags = out.flags();
+		const std::streamsize precision = out.precision();
+		out << std::fixed << std::setprecision(3);
+		out << "{\"traceEvents\":[";
+		bool first = true;
+		for (const std::shared_ptr<internal::TraceBuffer> &buffer : buffers) {
+			const SizeType count = buffer->count.load(std::memory_order_acquire);
+			for (SizeType e = static_cast<SizeType>(0); e < count; ++e) {
+				const internal::TraceEvent &event = buffer->events[e];
+				out << (first ? "\n" : ",\n")
+				    << "{\"name\":\"" << event.name << "\",\"cat\":\"dope\",\"ph\":\"X\""
+				    << ",\"ts\":" << static_cast<double>(event.start) / 1000.0
+				    << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0
+				    << ",\"pid\":1,\"tid\":" << buffer->thread << '}';
+				first = false;
+			}
+		}
+		out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+		out.flags(flags);
+		out.precision(precision);
+	}
+
+	inline bool Tracing::writeChromeTrace(const std::string &path)
+	{
+		std::ofstream file(path);
+		if (!file)
+			return false;
+		writeChromeTrace(file);
+		return static_cast<bool>(file);
+	}
+
+	inline void Tracing::clear()
+	{
+		std::lock_guard<std::mutex> lock(internal::traceRegistry().mutex);
+		for (const std::shared_ptr<internal::TraceBuffer> &buffer : internal::traceRegistry().buffers) {
+			buffer->count.store(static_cast<SizeType>(0), std::memory_order_release);
+			buffer->dropped.store(static_cast<SizeType>(0), std::memory_order_relaxed);
+		}
+		internal::traceRegistry().dropped.store(static_cast<SizeType>(0), std::memory_order_relaxed);
+	}
+
+	inline SizeType Tracing::dropped()
+	{
+		std::lock_guard<std::mutex> lock(internal::traceRegistry().mutex);
+		SizeType total = internal::traceRegistry().dropped.load(std::memory_order_relaxed);
+		for (const std::shared_ptr<internal::TraceBuffer> &buffer : internal::traceRegistry().buffers)
+			total += buffer->dropped.load(std::memory_order_relaxed);
+		return total;
+	}
+
+
+
+	namespace internal {
+
+		inline TraceBuffer::TraceBuffer(const SizeType thread)
+		    : events(new TraceEvent[DOPE_TRACE_BUFFER_SIZE])
+		    , count(0)
+		    , dropped(0)
+		    , thread(thread)
+		    , open(nullptr)
+		{ }
+
+		inline void TraceBuffer::append(const TraceEvent &event)
+		{
+			const SizeType n = count.load(std::memory_order_relaxed);
+			if (n >= static_cast<SizeType>(DOPE_TRACE_BUFFER_SIZE)) {
+				dropped.fetch_add(static_cast<SizeType>(1), std::memory_order_relaxed);
+				return;
+			}
+			events[n] = event;
+			count.store(n + 1, std::memory_order_release);
+		}
+
+		inline TraceRegistry & traceRegistry()
+		{
+			static TraceRegistry registry;
+			return registry;
+		}
+
+		inline TraceLease::TraceLease()
+		    : buffer(nullptr)
+		{
+			TraceRegistry &registry = traceRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			if (!registry.released.empty()) {
+				buffer = registry.released.back();
+				registry.released.pop_back();
+			} else if (registry.buffers.size() < static_cast<SizeType>(DOPE_TRACE_MAX_BUFFERS)) {
+				registry.buffers.push_back(std::make_shared<TraceBuffer>(registry.buffers.size() + 1));
+				buffer = registry.buffers.back().get();
+			}
+		}
+
+		inline TraceLease::~TraceLease()
+		{
+			if (!buffer)
+				return;
+			TraceRegistry &registry = traceRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			buffer->open = nullptr;
+			registry.released.push_back(buffer);
+		}
+
+		inline TraceBuffer * traceBuffer()
+		{
+			static thread_local TraceLease lease;
+			return lease.buffer;
+		}
+
+		inline TraceScope::TraceScope(const char *name)
+		    : _buffer(traceBuffer())
+		    , _name(name)
+		    , _outer(nullptr)
+		    , _start(0)
+		{
+			if (!_buffer) {
+				traceRegistry().dropped.fetch_add(static_cast<SizeType>(1), std::memory_order_relaxed);
+				return;
+			}
+			_outer = _buffer->open;
+			if (_outer && std::strcmp(_outer, name) == 0) {
+				_buffer = nullptr;
+				return;
+			}
+			_buffer->open = name;
+			_start = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		inline TraceScope::~TraceScope()
+		{
+			if (!_buffer)
+				return;
+			const std::int64_t end = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			_buffer->open = _outer;
+			_buffer->append(TraceEvent{_name, _start, end - _start});
+		}
+
+	}
+
+}
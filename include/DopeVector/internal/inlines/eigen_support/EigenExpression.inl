@@ -27,11 +27,7 @@ namespace dope {
 		template < class Derived, class Er, typename T, SizeType Dimension, typename Op >
 		inline T EigenStaticArrayBinaryExpression<Derived, Er, T, Dimension, Op>::operator[](const SizeType i) const
 		{
-			if (!_values[i]) {
-				T t = _op(_el[i], _er.getAt(i));
-				_values[i] = [t]()->T{ return t; };
-			}
-			return _values[i]();
+			return _op(_el[i], _er.getAt(i));
 		}
 
 
@@ -47,11 +43,7 @@ namespace dope {
 		template < class El, typename T, SizeType Dimension, class Derived, typename Op >
 		inline T StaticArrayBinaryEigenExpression<El, T, Dimension, Derived, Op>::operator[](const SizeType i) const
 		{
-			if (!_values[i]) {
-				T t = _op(_el.getAt(i), _er[i]);
-				_values[i] = [t]()->T{ return t; };
-			}
-			return _values[i]();
+			return _op(_el.getAt(i), _er[i]);
 		}
 
 